@@ -0,0 +1,91 @@
+/**
+ * ==================================================================================
+ * @file        alias_sampler_bench.cpp
+ * @brief       别名表采样器与 std::discrete_distribution 的抽样速度对比
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 在多个下标数量 n 下，用与需求生成器相同的带集中度权重，
+ * 分别测量 AliasSampler 和 std::discrete_distribution 的每秒抽样次数。
+ *
+ * 用法：
+ *   LSGameDataGen_alias_bench [每组抽样次数，默认10000000]
+ *
+ * 输出示例：
+ *   n          discrete (M/s)   alias (M/s)   speedup
+ *   1000       45.1             152.3         3.38x
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "alias_sampler.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/**
+ * @brief 生成与需求生成器相同形式的带集中度权重
+ */
+static std::vector<double> makeWeights(int n, double concentration, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(0.5, 1.5);
+    std::vector<double> w(n);
+    for (int k = 0; k < n; ++k) {
+        w[k] = std::pow(dist(rng), 1.0 + concentration * 3.0);
+    }
+    return w;
+}
+
+/**
+ * @brief 计时执行 draws 次抽样，返回每秒抽样次数（百万）
+ *
+ * @param checksum 抽样结果之和，防止编译器优化掉循环
+ */
+template <class Draw>
+static double measure(long long draws, Draw draw, long long& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    long long sum = 0;
+    for (long long k = 0; k < draws; ++k) {
+        sum += draw();
+    }
+    auto end = std::chrono::steady_clock::now();
+    checksum += sum;
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return seconds > 0 ? draws / seconds / 1e6 : 0.0;
+}
+
+int main(int argc, char* argv[]) {
+    long long draws = 10000000;
+    if (argc > 1) draws = std::atoll(argv[1]);
+    if (draws <= 0) draws = 10000000;
+
+    const int sizes[] = {10, 100, 1000, 10000, 100000, 1000000};
+    long long checksum = 0;
+
+    std::printf("draws per size: %lld\n", draws);
+    std::printf("%-10s %-16s %-14s %s\n", "n", "discrete (M/s)", "alias (M/s)", "speedup");
+
+    for (int n : sizes) {
+        std::mt19937 weight_rng(42);
+        std::vector<double> weights = makeWeights(n, 0.3, weight_rng);
+
+        std::discrete_distribution<int> discrete(weights.begin(), weights.end());
+        AliasSampler alias(weights);
+
+        std::mt19937 rng_a(7);
+        double discrete_rate = measure(draws, [&] { return discrete(rng_a); }, checksum);
+
+        std::mt19937 rng_b(7);
+        double alias_rate = measure(draws, [&] { return alias(rng_b); }, checksum);
+
+        std::printf("%-10d %-16.1f %-14.1f %.2fx\n", n, discrete_rate, alias_rate,
+                    discrete_rate > 0 ? alias_rate / discrete_rate : 0.0);
+    }
+
+    std::printf("checksum: %lld\n", checksum);
+    return 0;
+}
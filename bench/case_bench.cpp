@@ -0,0 +1,364 @@
+/**
+ * ==================================================================================
+ * @file        case_bench.cpp
+ * @brief       算例生成全流程基准测试（S1-S5 规模阶梯）
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 在一组预设规模上重复"构建 → 验证 → 写出"完整流程，借助 PhaseTimers
+ * 分别统计各阶段的每次耗时，输出中位数和 p95：
+ * - build:    CaseBuilder::Build（含 demand）
+ * - demand:   DemandGenerator::Generate
+ * - validate: CaseGenerator::Validate
+ * - transfer: 转运成本和BigM段（流式来源在写出时即时构造，因此构造与写出一并计时）
+ * - write:    CaseGenerator::GenerateCsv 写出整个算例（含 validate、transfer）
+ *
+ * 预设规模（N×demand_intensity×sY 固定为默认产能的 1/4，各规模都有可用产能）：
+ *   S1   6 ×  100 × 4  ×  30   转运成本扰动 0.1
+ *   S2  10 ×  500 × 4  ×  60   转运成本扰动 0.1
+ *   S3  20 × 1000 × 8  × 120   统一转运成本
+ *   S4  30 × 2000 × 8  × 240   统一转运成本
+ *   S5  50 × 5000 × 16 × 365   统一转运成本
+ * S3 起转运成本逐条覆盖项达 U×(U-1)×N×T ≥ 4.5×10^7 条，只用默认值。
+ *
+ * 用法：
+ *   LSGameDataGen_bench [--scales S1,S2,...] [--reps <n>] [--warmup <n>]
+ *                       [--threads <n>] [--format <csv|binary>]
+ *                       [--sink <文件>] [--json <文件>] [--perf]
+ *
+ *   --reps    每个规模的计时次数（默认5）
+ *   --warmup  每个规模计时前的预热次数（默认1）
+ *   --threads 需求生成线程数（默认1，0 = 全部硬件线程）
+ *   --sink    算例写出目标（默认系统临时目录下的文件，每次写完删除；可用 /dev/null 排除磁盘）
+ *   --json    把结果另存为 JSON 文件
+ *   --perf    同时采集各阶段的硬件计数（周期、指令、缓存未命中、分支预测失败；
+ *             Linux perf_event_open，不可用时给出原因并只计时；只统计主线程，宜配合 --threads 1）
+ *
+ * 以 -DDATAGEN_ALLOC_TRACKING=ON 构建时另外输出各阶段每次计时的分配次数和MB；
+ * 结束时输出进程峰值常驻内存（VmHWM）。
+ *
+ * 输出示例：
+ *   scale phase         median_ms       p95_ms           rows       rows/s       MB/s
+ *   S1    demand              0.192        0.206           2700     14059278          -
+ *   S1    write               4.989        5.413          93895     18821533      422.8
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "case_generator.h"
+#include "case_spec.h"
+#include "case_writer.h"
+#include "phase_timer.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @struct Scale
+ * @brief  一个预设规模
+ */
+struct Scale {
+    const char* name;
+    int U;
+    int N;
+    int G;
+    int T;
+    double transfer_cost_jitter;
+};
+
+static const Scale kScales[] = {
+    {"S1",  6,  100,  4,  30, 0.1},
+    {"S2", 10,  500,  4,  60, 0.1},
+    {"S3", 20, 1000,  8, 120, 0.0},
+    {"S4", 30, 2000,  8, 240, 0.0},
+    {"S5", 50, 5000, 16, 365, 0.0},
+};
+
+/**
+ * @struct PhaseSamples
+ * @brief  一个阶段在各次计时中的耗时
+ */
+struct PhaseSamples {
+    std::string name;
+    std::vector<double> ms;  ///< 每次计时的耗时（毫秒）
+    uint64_t rows = 0;       ///< 每次处理的行数（各次相同）
+    uint64_t bytes = 0;      ///< 每次处理的字节数（各次相同）
+    uint64_t counted = 0;    ///< 带硬件计数的计时次数
+    PerfSample counters;     ///< 硬件计数之和
+    AllocSample allocations; ///< 每次计时的分配（各次基本相同，取最后一次）
+};
+
+/**
+ * @struct ScaleResult
+ * @brief  一个规模的全部计时结果
+ */
+struct ScaleResult {
+    Scale scale;
+    size_t demand_count = 0;
+    std::vector<PhaseSamples> phases;
+};
+
+/**
+ * @brief 由预设规模构造规格
+ */
+static CaseSpec makeSpec(const Scale& scale) {
+    CaseSpec spec;
+    spec.U = scale.U;
+    spec.N = scale.N;
+    spec.G = scale.G;
+    spec.T = scale.T;
+    spec.unit_sY = spec.default_capacity / 4.0 / (spec.N * spec.demand_intensity);
+    spec.transfer_cost_jitter = scale.transfer_cost_jitter;
+    return spec;
+}
+
+/**
+ * @brief 有序样本的分位数（最近秩法）
+ */
+static double percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) return 0.0;
+    std::sort(samples.begin(), samples.end());
+    size_t rank = static_cast<size_t>(std::ceil(p * samples.size()));
+    return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+}
+
+/**
+ * @brief 执行一次完整流程，返回各阶段统计
+ */
+static std::vector<PhaseStats> runOnce(const CaseSpec& spec, GeneratorConfig& gc, unsigned threads,
+                                       CaseFormat format, const std::string& sink, bool remove_sink) {
+    PhaseTimers::Reset();
+    CaseBuilder::Build(spec, gc, threads);
+    {
+        ScopedPhaseTimer timer("write");
+        auto writer = CaseWriter::Open(sink, format);
+        CaseGenerator::GenerateCsv(gc, *writer);
+        writer->close();
+        timer.addRows(writer->rowsWritten());
+        timer.addBytes(writer->bytesWritten());
+    }
+    if (remove_sink) std::filesystem::remove(sink);
+    return PhaseTimers::Snapshot();
+}
+
+/**
+ * @brief 对一个规模预热并重复计时
+ */
+static ScaleResult benchScale(const Scale& scale, int warmup, int reps, unsigned threads,
+                              CaseFormat format, const std::string& sink, bool remove_sink) {
+    CaseSpec spec = makeSpec(scale);
+    GeneratorConfig gc;
+    ScaleResult result{scale, 0, {}};
+
+    for (int k = 0; k < warmup; ++k) {
+        runOnce(spec, gc, threads, format, sink, remove_sink);
+    }
+    for (int k = 0; k < reps; ++k) {
+        for (const PhaseStats& stats : runOnce(spec, gc, threads, format, sink, remove_sink)) {
+            auto it = std::find_if(result.phases.begin(), result.phases.end(),
+                                   [&](const PhaseSamples& p) { return p.name == stats.name; });
+            if (it == result.phases.end()) {
+                it = result.phases.emplace(result.phases.end());
+                it->name = stats.name;
+            }
+            it->ms.push_back(static_cast<double>(stats.nanos) / 1e6);
+            it->rows = stats.rows;
+            it->bytes = stats.bytes;
+            it->counted += stats.counted_calls;
+            it->counters.add(stats.counters);
+            it->allocations = stats.allocations;
+        }
+    }
+    result.demand_count = gc.demand.size();
+    return result;
+}
+
+/**
+ * @brief 每次计时的平均硬件计数
+ */
+static PerfSample meanCounters(const PhaseSamples& ph) {
+    if (ph.counted == 0) return {};
+    return {ph.counters.cycles / ph.counted, ph.counters.instructions / ph.counted,
+            ph.counters.cache_misses / ph.counted, ph.counters.branch_misses / ph.counted,
+            ph.counters.time_enabled / ph.counted, ph.counters.time_running / ph.counted};
+}
+
+/**
+ * @brief 把结果写为 JSON
+ */
+static void writeJson(const std::string& path, const std::vector<ScaleResult>& results,
+                      int warmup, int reps, unsigned threads, CaseFormat format) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) throw std::runtime_error("无法创建JSON文件: " + path);
+
+    std::fprintf(f, "{\n  \"benchmark\": \"LSGameDataGen_bench\",\n");
+    std::fprintf(f, "  \"warmup\": %d,\n  \"reps\": %d,\n  \"threads\": %u,\n  \"format\": \"%s\",\n",
+                 warmup, reps, threads, CaseWriter::FormatName(format));
+    std::fprintf(f, "  \"peak_rss_bytes\": %llu,\n",
+                 static_cast<unsigned long long>(MemStats::PeakRssBytes()));
+    std::fprintf(f, "  \"scales\": [\n");
+    for (size_t s = 0; s < results.size(); ++s) {
+        const ScaleResult& r = results[s];
+        std::fprintf(f, "    {\"name\": \"%s\", \"U\": %d, \"N\": %d, \"G\": %d, \"T\": %d, "
+                        "\"transfer_cost_jitter\": %g, \"demand_count\": %zu, \"phases\": {\n",
+                     r.scale.name, r.scale.U, r.scale.N, r.scale.G, r.scale.T,
+                     r.scale.transfer_cost_jitter, r.demand_count);
+        for (size_t p = 0; p < r.phases.size(); ++p) {
+            const PhaseSamples& ph = r.phases[p];
+            std::fprintf(f, "      \"%s\": {\"median_ms\": %.6f, \"p95_ms\": %.6f, "
+                            "\"min_ms\": %.6f, \"max_ms\": %.6f, \"rows\": %llu, \"bytes\": %llu, "
+                            "\"samples_ms\": [",
+                         ph.name.c_str(), percentile(ph.ms, 0.5), percentile(ph.ms, 0.95),
+                         percentile(ph.ms, 0.0), percentile(ph.ms, 1.0),
+                         static_cast<unsigned long long>(ph.rows),
+                         static_cast<unsigned long long>(ph.bytes));
+            for (size_t k = 0; k < ph.ms.size(); ++k) {
+                std::fprintf(f, "%s%.6f", k ? ", " : "", ph.ms[k]);
+            }
+            std::fprintf(f, "]");
+            if (MemStats::kAllocTracking) {
+                std::fprintf(f, ", \"allocations\": %llu, \"alloc_bytes\": %llu",
+                             static_cast<unsigned long long>(ph.allocations.allocations),
+                             static_cast<unsigned long long>(ph.allocations.bytes));
+            }
+            if (ph.counted > 0) {
+                PerfSample c = meanCounters(ph);
+                std::fprintf(f, ", \"counters\": {\"cycles\": %llu, \"instructions\": %llu, "
+                                "\"cache_misses\": %llu, \"branch_misses\": %llu}",
+                             static_cast<unsigned long long>(c.cycles),
+                             static_cast<unsigned long long>(c.instructions),
+                             static_cast<unsigned long long>(c.cache_misses),
+                             static_cast<unsigned long long>(c.branch_misses));
+            }
+            std::fprintf(f, "}%s\n", p + 1 < r.phases.size() ? "," : "");
+        }
+        std::fprintf(f, "    }}%s\n", s + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        std::vector<Scale> scales(std::begin(kScales), std::end(kScales));
+        int reps = 5;
+        int warmup = 1;
+        unsigned threads = 1;
+        CaseFormat format = CaseFormat::Csv;
+        std::string sink;
+        std::string json;
+        bool perf = false;
+
+        for (int a = 1; a < argc; ++a) {
+            std::string arg = argv[a];
+            if (arg == "--scales" && a + 1 < argc) {
+                scales.clear();
+                std::string list = argv[++a];
+                for (size_t begin = 0; begin <= list.size();) {
+                    size_t end = std::min(list.find(',', begin), list.size());
+                    std::string name = list.substr(begin, end - begin);
+                    auto it = std::find_if(std::begin(kScales), std::end(kScales),
+                                           [&](const Scale& s) { return name == s.name; });
+                    if (it == std::end(kScales)) throw std::runtime_error("未知的规模: " + name);
+                    scales.push_back(*it);
+                    begin = end + 1;
+                }
+            } else if (arg == "--reps" && a + 1 < argc) {
+                reps = std::max(1, std::atoi(argv[++a]));
+            } else if (arg == "--warmup" && a + 1 < argc) {
+                warmup = std::max(0, std::atoi(argv[++a]));
+            } else if (arg == "--threads" && a + 1 < argc) {
+                threads = WorkStealingPool::ParseThreads(argv[++a]);
+            } else if (arg == "--format" && a + 1 < argc) {
+                format = CaseWriter::ParseFormat(argv[++a]);
+            } else if (arg == "--sink" && a + 1 < argc) {
+                sink = argv[++a];
+            } else if (arg == "--json" && a + 1 < argc) {
+                json = argv[++a];
+            } else if (arg == "--perf") {
+                perf = true;
+            } else {
+                throw std::runtime_error("未知的命令行参数: " + arg +
+                    "（用法: LSGameDataGen_bench [--scales S1,S2,...] [--reps <n>] [--warmup <n>]"
+                    " [--threads <n>] [--format <csv|binary>] [--sink <文件>] [--json <文件>] [--perf]）");
+            }
+        }
+
+        bool remove_sink = sink.empty();
+        if (remove_sink) {
+            sink = (std::filesystem::temp_directory_path() /
+                    (std::string("LSGameDataGen_bench") + CaseWriter::Extension(format))).string();
+        }
+
+        std::string perf_reason;
+        if (perf && !PerfCounters::Enable(perf_reason)) {
+            std::printf("硬件计数器不可用，只计时: %s\n", perf_reason.c_str());
+            perf = false;
+        }
+
+        std::printf("warmup: %d  reps: %d  threads: %u  sink: %s\n", warmup, reps, threads, sink.c_str());
+        std::printf("%-5s %-12s %12s %12s %14s %12s %10s\n",
+                    "scale", "phase", "median_ms", "p95_ms", "rows", "rows/s", "MB/s");
+
+        std::vector<ScaleResult> results;
+        for (const Scale& scale : scales) {
+            results.push_back(benchScale(scale, warmup, reps, threads, format, sink, remove_sink));
+            for (const PhaseSamples& ph : results.back().phases) {
+                double median = percentile(ph.ms, 0.5);
+                double seconds = median / 1e3;
+                char rows_rate[32] = "-";
+                char mb_rate[32] = "-";
+                if (ph.rows > 0 && seconds > 0) {
+                    std::snprintf(rows_rate, sizeof(rows_rate), "%.0f", ph.rows / seconds);
+                }
+                if (ph.bytes > 0 && seconds > 0) {
+                    std::snprintf(mb_rate, sizeof(mb_rate), "%.1f", ph.bytes / (1024.0 * 1024.0) / seconds);
+                }
+                std::printf("%-5s %-12s %12.3f %12.3f %14llu %12s %10s\n",
+                            scale.name, ph.name.c_str(), median, percentile(ph.ms, 0.95),
+                            static_cast<unsigned long long>(ph.rows), rows_rate, mb_rate);
+            }
+            if (perf) {
+                std::printf("%-5s %-12s %12s %12s %8s %14s %14s\n",
+                            "", "", "Mcycles", "Minstr", "IPC", "cache_miss", "branch_miss");
+                for (const PhaseSamples& ph : results.back().phases) {
+                    if (ph.counted == 0) continue;
+                    PerfSample c = meanCounters(ph);
+                    std::printf("%-5s %-12s %12.2f %12.2f %8.2f %14llu %14llu\n",
+                                scale.name, ph.name.c_str(), c.cycles / 1e6, c.instructions / 1e6,
+                                c.cycles > 0 ? static_cast<double>(c.instructions) / c.cycles : 0.0,
+                                static_cast<unsigned long long>(c.cache_misses),
+                                static_cast<unsigned long long>(c.branch_misses));
+                }
+            }
+            if (MemStats::kAllocTracking) {
+                std::printf("%-5s %-12s %14s %12s\n", "", "", "allocs", "alloc_MB");
+                for (const PhaseSamples& ph : results.back().phases) {
+                    std::printf("%-5s %-12s %14llu %12.2f\n", scale.name, ph.name.c_str(),
+                                static_cast<unsigned long long>(ph.allocations.allocations),
+                                ph.allocations.bytes / (1024.0 * 1024.0));
+                }
+            }
+            std::fflush(stdout);
+        }
+        std::printf("peak RSS: %.1f MB\n", MemStats::PeakRssBytes() / (1024.0 * 1024.0));
+
+        if (!json.empty()) {
+            writeJson(json, results, warmup, reps, threads, format);
+            std::printf("json: %s\n", json.c_str());
+        }
+    } catch (const std::exception& ex) {
+        std::fprintf(stderr, "[错误] %s\n", ex.what());
+        return 1;
+    }
+    return 0;
+}
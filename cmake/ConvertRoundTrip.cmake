@@ -0,0 +1,56 @@
+# Convert round-trip check (ctest DataGen_Convert_RoundTrip_Test)
+# Generates the cases of SPEC as CSV with lossless floats, converts each one to
+# the binary format and back to CSV, and requires the result to be byte-identical.
+# With THREADS set, the conversions run with --threads THREADS and every case
+# must be large enough for the chunked CSV parser (2 x kMinChunkBytes = 2 MiB),
+# so the test exercises CaseReader::LoadParallel rather than its fallback.
+#
+# Usage: cmake -DGENERATOR=<LSGameDataGen> -DSPEC=<spec file> -DWORK_DIR=<dir>
+#              [-DTHREADS=<n>] -P ConvertRoundTrip.cmake
+
+foreach(var GENERATOR SPEC WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+function(run_generator)
+    execute_process(COMMAND ${GENERATOR} ${ARGN} --exact-floats all RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "LSGameDataGen ${ARGN} failed: ${result}")
+    endif()
+endfunction()
+
+set(convert_args)
+if(DEFINED THREADS)
+    set(convert_args --threads ${THREADS})
+endif()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+run_generator(--batch ${SPEC} --output-dir ${WORK_DIR}/csv)
+
+file(GLOB cases ${WORK_DIR}/csv/case_*.csv)
+if(NOT cases)
+    message(FATAL_ERROR "No cases generated in ${WORK_DIR}/csv")
+endif()
+
+foreach(original ${cases})
+    get_filename_component(stem ${original} NAME_WE)
+    if(DEFINED THREADS)
+        file(SIZE ${original} size)
+        if(size LESS 2097152)
+            message(FATAL_ERROR "${stem}: ${size} bytes is below the 2 MiB chunked-parse threshold")
+        endif()
+    endif()
+    run_generator(--convert ${original} --format binary --output-dir ${WORK_DIR}/binary ${convert_args})
+    run_generator(--convert ${WORK_DIR}/binary/${stem}.lsgc --format csv --output-dir ${WORK_DIR}/roundtrip
+                  ${convert_args})
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${original} ${WORK_DIR}/roundtrip/${stem}.csv
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${stem}: CSV -> .lsgc -> CSV round trip differs from the original")
+    endif()
+endforeach()
+
+list(LENGTH cases count)
+message(STATUS "${count} cases round-tripped byte-identically")
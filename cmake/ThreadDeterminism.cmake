@@ -0,0 +1,36 @@
+# Thread-count determinism check (ctest DataGen_Thread_Determinism_Test)
+# Generates the single case of SPEC with --threads 1 and with --threads 4 and
+# requires byte-identical output. SPEC must be large enough for the parallel
+# demand path (at least 2 x 65536 demand points).
+#
+# Usage: cmake -DGENERATOR=<LSGameDataGen> -DSPEC=<spec file> -DWORK_DIR=<dir> -P ThreadDeterminism.cmake
+
+foreach(var GENERATOR SPEC WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+
+set(outputs)
+foreach(threads 1 4)
+    execute_process(COMMAND ${GENERATOR} --batch ${SPEC} --threads ${threads}
+                            --output-dir ${WORK_DIR}/threads_${threads}
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "LSGameDataGen --threads ${threads} failed: ${result}")
+    endif()
+    file(GLOB cases ${WORK_DIR}/threads_${threads}/case_*.csv)
+    list(LENGTH cases count)
+    if(NOT count EQUAL 1)
+        message(FATAL_ERROR "Expected one case with --threads ${threads}, found ${count}")
+    endif()
+    list(APPEND outputs ${cases})
+endforeach()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${outputs} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Output differs between --threads 1 and --threads 4")
+endif()
+message(STATUS "--threads 1 and --threads 4 produced identical output")
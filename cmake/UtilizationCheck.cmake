@@ -0,0 +1,61 @@
+# Capacity utilization check (ctest DataGen_Utilization_Test)
+# Generates every case of SPEC. The generator itself fails a case whose total
+# demand drifts more than 3% from capacity_utilization x production capacity,
+# so the batch must succeed. Within each (U, node_concentration) group the
+# per-period volume spread (summary.period_volume_cv in the case reports) must
+# grow strictly with time_concentration.
+#
+# Usage: cmake -DGENERATOR=<LSGameDataGen> -DSPEC=<spec file> -DWORK_DIR=<dir> -P UtilizationCheck.cmake
+
+foreach(var GENERATOR SPEC WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+
+execute_process(COMMAND ${GENERATOR} --batch ${SPEC} --output-dir ${WORK_DIR}
+                RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "LSGameDataGen --batch failed: ${result}")
+endif()
+
+file(GLOB reports ${WORK_DIR}/case_*.json)
+list(LENGTH reports count)
+if(count LESS 2)
+    message(FATAL_ERROR "Expected at least two case reports, found ${count}")
+endif()
+
+set(cases)
+foreach(report ${reports})
+    file(READ ${report} json)
+    string(JSON units GET "${json}" spec U)
+    string(JSON node GET "${json}" spec node_concentration)
+    string(JSON time GET "${json}" spec time_concentration)
+    string(JSON cv GET "${json}" summary period_volume_cv)
+    list(APPEND cases "${units}|${node}|${time}|${cv}")
+endforeach()
+
+foreach(a ${cases})
+    string(REPLACE "|" ";" a "${a}")
+    list(GET a 0 a_units)
+    list(GET a 1 a_node)
+    list(GET a 2 a_time)
+    list(GET a 3 a_cv)
+    foreach(b ${cases})
+        string(REPLACE "|" ";" b "${b}")
+        list(GET b 0 b_units)
+        list(GET b 1 b_node)
+        list(GET b 2 b_time)
+        list(GET b 3 b_cv)
+        if(a_units EQUAL b_units AND a_node EQUAL b_node AND a_time LESS b_time
+           AND NOT a_cv LESS b_cv)
+            message(FATAL_ERROR "period_volume_cv does not grow with time_concentration "
+                                "(U=${a_units}, node_concentration=${a_node}): "
+                                "${a_time} -> ${a_cv}, ${b_time} -> ${b_cv}")
+        endif()
+    endforeach()
+endforeach()
+message(STATUS "Utilization within 3% and period spread grows with time_concentration "
+               "across ${count} cases")
@@ -0,0 +1,75 @@
+/**
+ * ==================================================================================
+ * @file        alias_sampler.cpp
+ * @brief       别名表离散采样器 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 Vose 建表算法：
+ * 1. 把权重缩放为均值1的概率 p[k] = w[k] × n / sum(w)
+ * 2. 将 p<1 的桶放入 small 列表，p>=1 的桶放入 large 列表
+ * 3. 每次取一个 small 桶 s 和一个 large 桶 l：
+ *    s 的剩余部分由 l 填补（alias[s] = l），l 的概率减去填补量
+ * 4. 剩余桶的概率因浮点误差可能略偏离1，统一置为1
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "alias_sampler.h"
+#include <stdexcept>
+
+/**
+ * @brief 由权重建表（Vose 算法）
+ */
+void AliasSampler::build(const std::vector<double>& weights) {
+    const size_t n = weights.size();
+    if (n == 0) {
+        throw std::invalid_argument("AliasSampler: 权重不能为空");
+    }
+
+    double sum = 0.0;
+    for (double w : weights) {
+        if (w < 0.0) throw std::invalid_argument("AliasSampler: 权重不能为负");
+        sum += w;
+    }
+    if (!(sum > 0.0)) {
+        throw std::invalid_argument("AliasSampler: 权重之和必须为正");
+    }
+
+    prob_.assign(n, 0.0);
+    alias_.assign(n, 0);
+
+    // 缩放为均值1的概率
+    std::vector<double> scaled(n);
+    for (size_t k = 0; k < n; ++k) {
+        scaled[k] = weights[k] * static_cast<double>(n) / sum;
+    }
+
+    // 划分 small / large 工作列表
+    std::vector<int> small, large;
+    small.reserve(n);
+    large.reserve(n);
+    for (size_t k = 0; k < n; ++k) {
+        if (scaled[k] < 1.0) small.push_back(static_cast<int>(k));
+        else large.push_back(static_cast<int>(k));
+    }
+
+    // 配对：small 桶的空缺由 large 桶填补
+    while (!small.empty() && !large.empty()) {
+        int s = small.back(); small.pop_back();
+        int l = large.back(); large.pop_back();
+
+        prob_[s] = scaled[s];
+        alias_[s] = l;
+
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if (scaled[l] < 1.0) small.push_back(l);
+        else large.push_back(l);
+    }
+
+    // 剩余桶（浮点误差导致未配对）概率置为1
+    for (int l : large) { prob_[l] = 1.0; alias_[l] = l; }
+    for (int s : small) { prob_[s] = 1.0; alias_[s] = s; }
+}
@@ -0,0 +1,94 @@
+/**
+ * ==================================================================================
+ * @file        alias_sampler.h
+ * @brief       别名表离散采样器 (Walker/Vose Alias Method) - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * AliasSampler 按给定权重从 {0, 1, ..., n-1} 中抽取下标：
+ * - 建表: O(n)（Vose 算法，数值稳定）
+ * - 抽样: O(1)，每次抽样只需一个 [0,1) 均匀随机数、一次乘法和一次比较
+ *
+ * std::discrete_distribution 在 libstdc++ 中通过累积分布二分查找实现，
+ * 每次抽样 O(log n)；需求生成中对节点、时段、物品各抽一次，
+ * N 较大、需求点达到百万级时差距明显。
+ *
+ * 使用示例：
+ * @code
+ * AliasSampler sampler(weights);     // 权重无需归一化
+ * int k = sampler(rng);              // rng 为任意 UniformRandomBitGenerator
+ * @endcode
+ *
+ * @note 权重必须非负且至少有一个为正
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <random>
+#include <vector>
+
+/**
+ * @class AliasSampler
+ * @brief 别名表离散采样器
+ */
+class AliasSampler {
+public:
+    AliasSampler() = default;
+
+    /**
+     * @brief 构造函数 - 由权重建表
+     *
+     * @param weights 各下标的权重（无需归一化）
+     *
+     * @throw std::invalid_argument 权重为空、含负数或总和不为正时抛出
+     */
+    explicit AliasSampler(const std::vector<double>& weights) { build(weights); }
+
+    /**
+     * @brief 由权重（重新）建表
+     *
+     * @param weights 各下标的权重（无需归一化）
+     *
+     * @throw std::invalid_argument 权重为空、含负数或总和不为正时抛出
+     */
+    void build(const std::vector<double>& weights);
+
+    /**
+     * @brief 下标数量
+     */
+    size_t size() const { return prob_.size(); }
+
+    /**
+     * @brief 用一个 [0,1) 均匀随机数抽取下标
+     *
+     * @param u01 [0,1) 区间的均匀随机数
+     * @return int 抽中的下标
+     *
+     * @details
+     * x = u01 × n，整数部分选择桶，小数部分决定取桶本身还是其别名。
+     */
+    int sample(double u01) const {
+        double x = u01 * static_cast<double>(prob_.size());
+        size_t k = static_cast<size_t>(x);
+        if (k >= prob_.size()) k = prob_.size() - 1;  // u01 非常接近1时的舍入保护
+        return (x - static_cast<double>(k)) < prob_[k] ? static_cast<int>(k) : alias_[k];
+    }
+
+    /**
+     * @brief 用随机数生成器抽取下标
+     *
+     * @param rng 随机数生成器
+     * @return int 抽中的下标
+     */
+    template <class URNG>
+    int operator()(URNG& rng) const {
+        return sample(std::generate_canonical<double, 53>(rng));
+    }
+
+private:
+    std::vector<double> prob_;  ///< 每个桶取自身下标的概率
+    std::vector<int> alias_;    ///< 每个桶的别名下标
+};
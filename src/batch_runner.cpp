@@ -0,0 +1,196 @@
+/**
+ * ==================================================================================
+ * @file        batch_runner.cpp
+ * @brief       批量算例生成器 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 BatchRunner：
+ * 1. 只解析一次输出目录、只创建一次目录
+ * 2. 逐个构建并写出算例，复用同一个 GeneratorConfig
+ * 3. 可选地在工作窃取线程池上并行生成算例
+ * 4. 写出批次清单，记录每个算例的文件名和主要参数
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "batch_runner.h"
+#include "output_paths.h"
+#include "phase_timer.h"
+#include "run_report.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// ====================================================================================
+// BatchRunner 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 默认的算例输出目录
+ */
+std::string BatchRunner::DefaultOutputDir() {
+    return OutputPaths::FindProjectRoot() + "/output/cases";
+}
+
+/**
+ * @brief 生成批量模式下的算例文件名
+ */
+std::string BatchRunner::CaseFileName(const std::string& output_dir,
+                                      const std::string& stamp,
+                                      size_t index,
+                                      const std::string& extension) {
+    std::ostringstream oss;
+    oss << output_dir << "/case_" << stamp << "_"
+        << std::setfill('0') << std::setw(5) << index << extension;
+    return oss.str();
+}
+
+/**
+ * @brief 估算算例的相对生成开销
+ *
+ * @details
+ * 开销主要来自写出的行数：产能 U×T、初始库存 U×N、需求约 U×N×T×密度。
+ * 统一转运成本和BigM只写默认值，与规模无关；
+ * 带扰动的转运成本逐条写出 U×(U-1)×N×T 行。
+ */
+double BatchRunner::EstimateCost(const CaseSpec& spec) {
+    double U = spec.U, N = spec.N, T = spec.T;
+    double cost = U * T + U * N + U * N * T * spec.demand_intensity + N;
+    if (spec.enable_transfer && spec.transfer_cost_jitter > 0.0) {
+        cost += U * (U - 1) * N * T;
+    }
+    return cost;
+}
+
+/**
+ * @brief 生成所有算例（顺序或并行）
+ */
+BatchResult BatchRunner::Run(const std::vector<CaseSpec>& specs,
+                             const BatchOptions& options,
+                             Logger& logger) {
+    BatchResult result;
+
+    // 输出目录和批次时间戳只确定一次
+    std::string output_dir = options.output_dir.empty() ? DefaultOutputDir() : options.output_dir;
+    std::string stamp = options.stamp.empty() ? OutputPaths::FileStamp(OutputPaths::Now()) : options.stamp;
+    OutputPaths::EnsureDirectory(output_dir);
+
+    unsigned threads = options.threads == 0 ? WorkStealingPool::DefaultThreads() : options.threads;
+
+    logger.log("批量生成 " + std::to_string(specs.size()) + " 个算例，线程数: " +
+               std::to_string(threads) + "，输出目录: " + output_dir);
+
+    // 清单文件：每个算例一行（先打开，尽早发现目录不可写）
+    result.manifest_file = output_dir + "/batch_" + stamp + ".csv";
+    std::ofstream manifest(result.manifest_file, std::ios::out | std::ios::trunc);
+    if (!manifest) {
+        throw std::runtime_error("无法打开清单文件: " + result.manifest_file);
+    }
+
+    result.files.assign(specs.size(), "");
+    std::vector<CaseSummary> summaries(specs.size());
+    std::vector<char> ok(specs.size(), 0);
+
+    // 生成单个算例；gc 由调用方提供以便复用内存
+    auto generate_one = [&](size_t k, GeneratorConfig& gc, unsigned demand_threads) {
+        const CaseSpec& spec = specs[k];
+        std::string output_file = CaseFileName(output_dir, stamp, k, CaseWriter::Extension(options.format));
+        std::string tag = "[" + std::to_string(k + 1) + "/" + std::to_string(specs.size()) + "] ";
+
+        ScopedPhaseTimer case_timer("case");
+        case_timer.setDetail(output_file);
+        try {
+            summaries[k] = CaseBuilder::Build(spec, gc, demand_threads);
+
+            RunReport report;
+            {
+                ScopedPhaseTimer timer("write");
+                auto writer = CaseWriter::Open(output_file, options.format, options.exact_floats);
+                report.sections = CaseGenerator::GenerateCsv(gc, *writer);
+                writer->close();
+                report.rows_written = writer->rowsWritten();
+                report.bytes_written = writer->bytesWritten();
+                timer.addRows(report.rows_written);
+                timer.addBytes(report.bytes_written);
+                report.phase_nanos = {{"build", summaries[k].build_nanos},
+                                      {"demand", summaries[k].demand_nanos},
+                                      {"write", timer.elapsedNanos()}};
+            }
+
+            // 运行报告：与算例同名的 .json
+            report.case_file = output_file;
+            report.format = CaseWriter::FormatName(options.format);
+            report.mode = "batch";
+            report.spec = &spec;
+            report.summary = &summaries[k];
+            RunReportWriter::Write(report);
+
+            result.files[k] = output_file;
+            ok[k] = 1;
+
+            const DemandGenStats& stats = summaries[k].demand_stats;
+            logger.log(tag + output_file +
+                       " U=" + std::to_string(spec.U) + " N=" + std::to_string(spec.N) +
+                       " G=" + std::to_string(spec.G) + " T=" + std::to_string(spec.T) +
+                       " seed=" + std::to_string(spec.seed) +
+                       " 需求数=" + std::to_string(summaries[k].demand_count) +
+                       " 利用率=" + std::to_string(summaries[k].actual_utilization * 100) + "%" +
+                       (stats.degenerate() ? " [退化路径] " + stats.toString() : ""));
+        } catch (const std::exception& ex) {
+            logger.log(tag + "[错误] " + std::string(ex.what()));
+        }
+    };
+
+    if (threads <= 1 || specs.size() <= 1) {
+        // 顺序生成：所有算例共用一个配置对象；只有一个算例时线程用于该算例的需求生成
+        GeneratorConfig gc;
+        for (size_t k = 0; k < specs.size(); ++k) {
+            generate_one(k, gc, threads);
+        }
+    } else {
+        // 并行生成：按估算开销从大到小提交，大算例先开始
+        std::vector<size_t> order(specs.size());
+        for (size_t k = 0; k < order.size(); ++k) order[k] = k;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return EstimateCost(specs[a]) > EstimateCost(specs[b]);
+        });
+
+        WorkStealingPool pool(threads);
+        for (size_t k : order) {
+            pool.submit([&generate_one, k] {
+                // 每个工作线程复用自己的配置对象
+                thread_local GeneratorConfig gc;
+                generate_one(k, gc, 1);
+            });
+        }
+        pool.wait();
+    }
+
+    // 按序号写出清单，与线程调度顺序无关
+    manifest << "index,file,U,N,G,T,enable_transfer,seed,capacity_utilization,demand_intensity,"
+                "demand_count,actual_utilization,status\n";
+    for (size_t k = 0; k < specs.size(); ++k) {
+        const CaseSpec& spec = specs[k];
+        const CaseSummary& summary = summaries[k];
+        if (ok[k]) ++result.succeeded; else ++result.failed;
+
+        manifest << k << ','
+                 << (ok[k] ? result.files[k].substr(output_dir.size() + 1) : "") << ','
+                 << spec.U << ',' << spec.N << ',' << spec.G << ',' << spec.T << ','
+                 << (spec.enable_transfer ? 1 : 0) << ',' << spec.seed << ','
+                 << spec.capacity_utilization << ',' << spec.demand_intensity << ','
+                 << summary.demand_count << ',' << summary.actual_utilization << ','
+                 << (ok[k] ? "ok" : "failed") << '\n';
+    }
+
+    logger.log("批量生成完成: 成功 " + std::to_string(result.succeeded) +
+               " 个，失败 " + std::to_string(result.failed) + " 个");
+    logger.log("清单文件: " + result.manifest_file);
+
+    return result;
+}
@@ -0,0 +1,110 @@
+/**
+ * ==================================================================================
+ * @file        batch_runner.h
+ * @brief       批量算例生成器 - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 在一个进程内按顺序生成多个算例，避免每个算例都重新启动程序、
+ * 重新探测项目根目录和创建输出目录。
+ *
+ * 输出文件：
+ * - 算例文件: <output_dir>/case_<批次时间戳>_<序号>.csv（序号5位，从00000开始）
+ * - 运行报告: <output_dir>/case_<批次时间戳>_<序号>.json（见 run_report.h）
+ * - 清单文件: <output_dir>/batch_<批次时间戳>.csv，记录序号、文件名和主要参数
+ *
+ * 同一批次的文件名只由批次时间戳和序号决定，不会因为同一秒内生成多个算例而冲突。
+ *
+ * 并行生成：
+ * - threads != 1 时使用 WorkStealingPool 在多个线程上同时生成不同算例
+ * - 任务按估算开销从大到小提交，工作窃取负责平衡剩余的负载
+ * - 每个算例只依赖自身的规格和种子，输出与顺序生成逐字节一致
+ * - 清单按序号顺序写出，与线程调度无关
+ * - 只有一个算例时，线程用于该算例内部按(u,t)并行生成需求
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "case_spec.h"
+#include "case_writer.h"
+#include "logger.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct BatchOptions
+ * @brief  批量生成选项
+ */
+struct BatchOptions {
+    std::string output_dir;  ///< 算例输出目录（为空时使用 <项目根目录>/output/cases）
+    std::string stamp;       ///< 批次时间戳（为空时使用当前时间）
+    unsigned threads = 1;    ///< 并行线程数（1 = 顺序生成，0 = 使用全部硬件线程）
+    std::string exact_floats; ///< 无损浮点输出的key（"all" 或逗号分隔列表，为空时截断为整数）
+    CaseFormat format = CaseFormat::Csv;  ///< 算例文件格式
+};
+
+/**
+ * @struct BatchResult
+ * @brief  批量生成结果
+ */
+struct BatchResult {
+    size_t succeeded = 0;            ///< 成功生成的算例数
+    size_t failed = 0;               ///< 生成失败的算例数
+    std::string manifest_file;       ///< 清单文件路径
+    std::vector<std::string> files;  ///< 各算例输出文件（失败的算例为空字符串）
+};
+
+/**
+ * @class BatchRunner
+ * @brief 批量算例生成器
+ *
+ * @note 所有方法都是静态的，不需要创建实例
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief 按顺序生成所有算例
+     *
+     * @param specs   算例规格列表
+     * @param options 批量生成选项
+     * @param logger  日志对象
+     * @return BatchResult 生成结果
+     *
+     * @details
+     * 单个算例失败（规格不合法、写文件失败等）只记录错误并继续下一个算例，
+     * 不会中断整个批次。每个线程复用自己的 GeneratorConfig 对象以减少内存分配。
+     */
+    static BatchResult Run(const std::vector<CaseSpec>& specs,
+                           const BatchOptions& options,
+                           Logger& logger);
+
+    /**
+     * @brief 默认的算例输出目录 <项目根目录>/output/cases
+     */
+    static std::string DefaultOutputDir();
+
+    /**
+     * @brief 生成批量模式下的算例文件名
+     *
+     * @param output_dir 输出目录
+     * @param stamp      批次时间戳
+     * @param index      算例序号
+     * @param extension  文件扩展名（含点号）
+     * @return std::string 形如 <output_dir>/case_<stamp>_00012.csv
+     */
+    static std::string CaseFileName(const std::string& output_dir,
+                                    const std::string& stamp,
+                                    size_t index,
+                                    const std::string& extension = ".csv");
+
+    /**
+     * @brief 估算算例的相对生成开销（用于并行调度排序）
+     *
+     * @param spec 算例规格
+     * @return double 与写出行数成正比的开销估计
+     */
+    static double EstimateCost(const CaseSpec& spec);
+};
@@ -0,0 +1,217 @@
+/**
+ * ==================================================================================
+ * @file        binary_case_writer.cpp
+ * @brief       二进制列式算例写入器 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 BinaryCaseWriter：
+ * 1. 构造时写出占位头部
+ * 2. 逐行追加到当前块的列缓存，(section, key) 变化或块满时整块写出
+ * 3. close() 时写出块目录和尾部，并回填头部的 U/N/G/T
+ *
+ * 小端序主机（x86/ARM）上列数组直接整体写出；大端序主机逐元素字节翻转。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "binary_case_writer.h"
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+// ====================================================================================
+// 构造函数和析构函数
+// ====================================================================================
+
+/**
+ * @brief 构造函数实现 - 打开文件并写出占位头部
+ */
+BinaryCaseWriter::BinaryCaseWriter(const std::string& path) : path_(path) {
+    ofs_.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!ofs_) {
+        throw std::runtime_error("无法打开输出文件: " + path);
+    }
+
+    // 头部：magic + version + reserved + U/N/G/T（close 时回填）
+    writeBytes(BinaryCaseFormat::kMagic, sizeof(BinaryCaseFormat::kMagic));
+    writeUInt(BinaryCaseFormat::kVersion, 4);
+    writeUInt(0, 4);
+    for (int k = 0; k < 4; ++k) writeUInt(0, 4);
+}
+
+/**
+ * @brief 析构函数实现 - 未显式关闭时完成写出
+ */
+BinaryCaseWriter::~BinaryCaseWriter() {
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+// ====================================================================================
+// 底层写出
+// ====================================================================================
+
+/**
+ * @brief 写出原始字节并推进偏移
+ */
+void BinaryCaseWriter::writeBytes(const void* data, size_t size) {
+    ofs_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    offset_ += size;
+}
+
+/**
+ * @brief 以小端序写出一个无符号整数
+ */
+void BinaryCaseWriter::writeUInt(uint64_t value, size_t width) {
+    unsigned char bytes[8];
+    for (size_t k = 0; k < width; ++k) {
+        bytes[k] = static_cast<unsigned char>(value >> (8 * k));
+    }
+    writeBytes(bytes, width);
+}
+
+/**
+ * @brief 以小端序写出数组
+ */
+template <class T>
+void BinaryCaseWriter::writeArray(const std::vector<T>& values) {
+    if constexpr (std::endian::native == std::endian::little) {
+        writeBytes(values.data(), values.size() * sizeof(T));
+    } else {
+        for (T value : values) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (size_t k = 0; k < sizeof(T) / 2; ++k) {
+                std::swap(bytes[k], bytes[sizeof(T) - 1 - k]);
+            }
+            writeBytes(bytes, sizeof(T));
+        }
+    }
+}
+
+// ====================================================================================
+// 数据行写入
+// ====================================================================================
+
+/**
+ * @brief 写入一行数据（整数值版本）
+ */
+void BinaryCaseWriter::writeRow(std::string_view section, std::string_view key,
+                                int u, int v, int i, int t,
+                                int value) {
+    writeRow(section, key, u, v, i, t, static_cast<double>(value));
+}
+
+/**
+ * @brief 写入一行数据（浮点数值版本）
+ *
+ * @details
+ * (section, key) 与当前块相同时只追加列值；否则先写出当前块再开始新块。
+ * 当前块满 kMaxBlockRows 行时也先写出，使内存占用有上界。
+ */
+void BinaryCaseWriter::writeRow(std::string_view section, std::string_view key,
+                                int u, int v, int i, int t,
+                                double value) {
+    if (closed_) {
+        throw std::runtime_error("写入已关闭的算例文件: " + path_);
+    }
+
+    if (!has_block_ || section != cur_section_ || key != cur_key_) {
+        flushBlock();
+        cur_section_.assign(section);
+        cur_key_.assign(key);
+        has_block_ = true;
+    } else if (values_.size() == BinaryCaseFormat::kMaxBlockRows) {
+        // 长段拆块：section/key 不变，只写出已缓存的行
+        flushBlock();
+        has_block_ = true;
+    }
+
+    ++rows_written_;
+    values_.push_back(value);
+    u_.push_back(u);
+    v_.push_back(v);
+    i_.push_back(i);
+    t_.push_back(t);
+}
+
+/**
+ * @brief 写出当前块并清空列缓存
+ *
+ * @details
+ * 列顺序为 value（float64）在前、四个 int32 索引列在后，
+ * 每块 24×rows 字节，头部 32 字节，因此所有 float64 数组都按8字节对齐。
+ */
+void BinaryCaseWriter::flushBlock() {
+    if (!has_block_) return;
+
+    // meta 段的 U/N/G/T 记录下来，关闭时回填到头部
+    if (cur_section_ == "meta" && !values_.empty()) {
+        static const char* const kDimKeys[4] = {"U", "N", "G", "T"};
+        for (int k = 0; k < 4; ++k) {
+            if (cur_key_ == kDimKeys[k]) dims_[k] = static_cast<int32_t>(values_.back());
+        }
+    }
+
+    blocks_.push_back({cur_section_, cur_key_, offset_, values_.size()});
+    writeArray(values_);
+    writeArray(u_);
+    writeArray(v_);
+    writeArray(i_);
+    writeArray(t_);
+
+    values_.clear();
+    u_.clear();
+    v_.clear();
+    i_.clear();
+    t_.clear();
+    has_block_ = false;
+}
+
+// ====================================================================================
+// 完成写出
+// ====================================================================================
+
+/**
+ * @brief 写出块目录和尾部，回填头部
+ */
+void BinaryCaseWriter::close() {
+    if (closed_) return;
+    closed_ = true;
+
+    flushBlock();
+
+    // 块目录
+    uint64_t footer_offset = offset_;
+    for (const BlockInfo& b : blocks_) {
+        writeUInt(b.section.size(), 2);
+        writeBytes(b.section.data(), b.section.size());
+        writeUInt(b.key.size(), 2);
+        writeBytes(b.key.data(), b.key.size());
+        writeUInt(b.offset, 8);
+        writeUInt(b.rows, 8);
+    }
+
+    // 尾部
+    writeUInt(footer_offset, 8);
+    writeUInt(blocks_.size(), 8);
+    writeBytes(BinaryCaseFormat::kEndMagic, sizeof(BinaryCaseFormat::kEndMagic));
+
+    // 回填头部的 U/N/G/T（offset_ 保持为文件总长度）
+    uint64_t file_size = offset_;
+    ofs_.seekp(16);
+    for (int k = 0; k < 4; ++k) {
+        writeUInt(static_cast<uint32_t>(dims_[k]), 4);
+    }
+    offset_ = file_size;
+
+    ofs_.close();
+    if (!ofs_) {
+        throw std::runtime_error("写入输出文件失败: " + path_);
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * ==================================================================================
+ * @file        binary_case_writer.h
+ * @brief       二进制列式算例写入器 - 头文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * BinaryCaseWriter 把 section,key,u,v,i,t,value 的逻辑行写成紧凑的二进制列式文件。
+ * 每个连续的 (section, key) 行组成一个数据块，块内按列存放，所有数值均为小端序：
+ *
+ * 文件布局：
+ * @code
+ * [头部 32 字节]
+ *   char[8]  magic     "LSGCBIN\0"
+ *   uint32   version   1
+ *   uint32   reserved  0
+ *   int32    U, N, G, T
+ * [数据块 × block_count]（每块起始偏移为8的倍数）
+ *   float64  value[rows]
+ *   int32    u[rows], v[rows], i[rows], t[rows]     （-1 表示不适用）
+ * [块目录]（footer_offset 处开始，每块一项）
+ *   uint16 section_len, char section[section_len]
+ *   uint16 key_len,     char key[key_len]
+ *   uint64 offset       数据块在文件中的字节偏移
+ *   uint64 rows         行数
+ * [尾部 24 字节]
+ *   uint64   footer_offset
+ *   uint64   block_count
+ *   char[8]  magic     "LSGCEND\0"
+ * @endcode
+ *
+ * 读取时先读尾部定位块目录，再按偏移直接读取（或 mmap）需要的列数组。
+ * 单块最多 kMaxBlockRows 行，更长的 (section, key) 段拆成多个相邻的块，
+ * 写入器内存占用与段长无关。
+ * 块按写出顺序排列；同一 (section, key) 可能出现在多个块中，
+ * 后面的块覆盖前面的块，与CSV中"后写的行覆盖先写的行"一致。
+ * 值一律以 float64 存储，不存在CSV截断整数的精度损失。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "case_writer.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct BinaryCaseFormat
+ * @brief  二进制算例格式常量
+ */
+struct BinaryCaseFormat {
+    static constexpr char kMagic[8] = {'L', 'S', 'G', 'C', 'B', 'I', 'N', '\0'};      ///< 头部魔数
+    static constexpr char kEndMagic[8] = {'L', 'S', 'G', 'C', 'E', 'N', 'D', '\0'};   ///< 尾部魔数
+    static constexpr uint32_t kVersion = 1;        ///< 格式版本
+    static constexpr size_t kHeaderSize = 32;      ///< 头部字节数
+    static constexpr size_t kTrailerSize = 24;     ///< 尾部字节数
+    static constexpr size_t kBytesPerRow = 8 + 4 * 4;  ///< 每行字节数（1个float64 + 4个int32）
+    static constexpr size_t kMaxBlockRows = 1 << 16;   ///< 写入器单块最大行数
+};
+
+/**
+ * @class BinaryCaseWriter
+ * @brief 二进制列式算例写入器
+ *
+ * @details
+ * 当前块的各列缓存在内存中，(section, key) 变化或达到 kMaxBlockRows 行时整块写出。
+ * U/N/G/T 取自 meta 段的对应行，在 close() 时回填到头部。
+ * 线程不安全，单线程使用；不可复制。
+ */
+class BinaryCaseWriter : public CaseWriter {
+public:
+    /**
+     * @brief 构造函数 - 打开文件并写出占位头部
+     *
+     * @param path 输出文件路径
+     *
+     * @throw std::runtime_error 当文件无法打开时抛出异常
+     */
+    explicit BinaryCaseWriter(const std::string& path);
+
+    /**
+     * @brief 析构函数 - 未显式关闭时完成写出（不抛出异常）
+     */
+    ~BinaryCaseWriter() override;
+
+    BinaryCaseWriter(const BinaryCaseWriter&) = delete;
+    BinaryCaseWriter& operator=(const BinaryCaseWriter&) = delete;
+
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  int value) override;
+
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  double value) override;
+
+    /**
+     * @brief 写出最后一个块、块目录和尾部，并回填头部的 U/N/G/T
+     *
+     * @throw std::runtime_error 当写文件失败时抛出异常
+     */
+    void close() override;
+
+    /**
+     * @brief 已产生的字节数（已写出的部分 + 当前块的列缓存）
+     */
+    uint64_t bytesWritten() const override {
+        return offset_ + values_.size() * BinaryCaseFormat::kBytesPerRow;
+    }
+
+private:
+    /**
+     * @struct BlockInfo
+     * @brief  块目录项
+     */
+    struct BlockInfo {
+        std::string section;  ///< 数据段名称
+        std::string key;      ///< 数据键名
+        uint64_t offset;      ///< 数据块字节偏移
+        uint64_t rows;        ///< 行数
+    };
+
+    std::ofstream ofs_;        ///< 输出文件流
+    std::string path_;         ///< 输出文件路径（用于错误信息）
+    bool closed_ = false;      ///< 是否已完成写出
+    uint64_t offset_ = 0;      ///< 当前写出位置
+    int32_t dims_[4] = {0, 0, 0, 0};  ///< U, N, G, T
+
+    std::string cur_section_;  ///< 当前块的 section
+    std::string cur_key_;      ///< 当前块的 key
+    bool has_block_ = false;   ///< 当前是否有未写出的块
+
+    std::vector<double> values_;  ///< 当前块的 value 列
+    std::vector<int32_t> u_;      ///< 当前块的 u 列
+    std::vector<int32_t> v_;      ///< 当前块的 v 列
+    std::vector<int32_t> i_;      ///< 当前块的 i 列
+    std::vector<int32_t> t_;      ///< 当前块的 t 列
+
+    std::vector<BlockInfo> blocks_;  ///< 已写出块的目录
+
+    /**
+     * @brief 写出当前块（若有）并清空列缓存
+     */
+    void flushBlock();
+
+    /**
+     * @brief 写出原始字节并推进偏移
+     */
+    void writeBytes(const void* data, size_t size);
+
+    /**
+     * @brief 以小端序写出数组
+     */
+    template <class T>
+    void writeArray(const std::vector<T>& values);
+
+    /**
+     * @brief 以小端序写出一个无符号整数（width 字节）
+     */
+    void writeUInt(uint64_t value, size_t width);
+};
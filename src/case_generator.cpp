@@ -30,6 +30,7 @@
  */
 
 #include "case_generator.h"
+#include "phase_timer.h"
 #include <unordered_set>
 #include <sstream>
 
@@ -74,6 +75,28 @@ static std::string quad(int a, int b, int c, int d) {
     return "(" + std::to_string(a) + "," + std::to_string(b) + "," + std::to_string(c) + "," + std::to_string(d) + ")";
 }
 
+/**
+ * @brief 验证一条转运成本覆盖项
+ *
+ * @details 先判断再拼接错误信息，逐条验证流式覆盖项时不产生临时字符串
+ */
+static void checkTransfer(const GeneratorConfig& g, const TransferEntry& e) {
+    if (!(0 <= e.u && e.u < g.U)) CHECK(false, "cT.u 越界");
+    if (!(0 <= e.v && e.v < g.U)) CHECK(false, "cT.v 越界");
+    if (!(0 <= e.i && e.i < g.N)) CHECK(false, "cT.i 越界");
+    if (!(0 <= e.t && e.t < g.T)) CHECK(false, "cT.t 越界");
+    if (!(e.cost >= 0.0)) CHECK(false, "cT.cost 需为非负, at " + quad(e.u, e.v, e.i, e.t));
+}
+
+/**
+ * @brief 验证一条BigM覆盖项
+ */
+static void checkBigM(const GeneratorConfig& g, const BigMEntry& m) {
+    if (!(0 <= m.i && m.i < g.N)) CHECK(false, "M.i 越界");
+    if (!(0 <= m.t && m.t < g.T)) CHECK(false, "M.t 越界");
+    if (!(m.M > 0.0)) CHECK(false, "M 值需为正");
+}
+
 // ====================================================================================
 // CaseGenerator 类方法实现
 // ====================================================================================
@@ -165,24 +188,18 @@ void CaseGenerator::Validate(const GeneratorConfig& g) {
     // ================================================================================
     if (g.enable_transfer) {
         // 当启用转运功能时，验证转运成本数据
-        for (const auto& e : g.transfer_costs) {
-            CHECK(0 <= e.u && e.u < g.U, "cT.u 越界");
-            CHECK(0 <= e.v && e.v < g.U, "cT.v 越界");
-            CHECK(0 <= e.i && e.i < g.N, "cT.i 越界");
-            CHECK(0 <= e.t && e.t < g.T, "cT.t 越界");
-            CHECK(e.cost >= 0.0, "cT.cost 需为非负, at " + quad(e.u,e.v,e.i,e.t));
-        }
+        CHECK(g.default_transfer_cost >= 0.0, "default_transfer_cost 需为非负");
+        for (const auto& e : g.transfer_costs) checkTransfer(g, e);
 
         // 验证BigM约束数据
-        for (const auto& m : g.bigM) {
-            CHECK(0 <= m.i && m.i < g.N, "M.i 越界");
-            CHECK(0 <= m.t && m.t < g.T, "M.t 越界");
-            CHECK(m.M > 0.0, "M 值需为正");
-        }
+        CHECK(g.default_bigM > 0.0, "default_bigM 需为正");
+        for (const auto& m : g.bigM) checkBigM(g, m);
     } else {
         // 当未启用转运功能时，不应该有转运相关配置
         CHECK(g.transfer_costs.empty(), "enable_transfer=0 时不应提供 transfer_costs");
         CHECK(g.bigM.empty(),           "enable_transfer=0 时不应提供 bigM");
+        CHECK(!g.transfer_source,       "enable_transfer=0 时不应提供 transfer_source");
+        CHECK(!g.bigM_source,           "enable_transfer=0 时不应提供 bigM_source");
     }
 }
 
@@ -225,17 +242,33 @@ void CaseGenerator::Validate(const GeneratorConfig& g) {
  *    - 未出现的(u,i,t)组合默认需求为0
  *
  * 7. transfer段 - 转运数据（可选，仅当enable_transfer=true）
- *    - cT[u,v,i,t]: 从节点u转运物品i到节点v在时间t的成本
+ *    - 先写出一行 cT_default：所有(u,v,i,t)的默认转运成本
+ *    - 再写出覆盖项 cT[u,v,i,t]（会覆盖默认值）：先 transfer_costs，再 transfer_source
+ *    - 行数为 O(覆盖项数)，不再随 U×(U-1)×N×T 增长
+ *    - transfer_source 产生的覆盖项直接写出，内存占用与覆盖项数无关
  *
  * 8. bigM段 - BigM约束（可选，仅当enable_transfer=true）
- *    - M[i,t]: 物品i在时间t的BigM值
+ *    - 先写出一行 M_default：所有(i,t)的默认BigM值
+ *    - 再写出覆盖项 M[i,t]（会覆盖默认值）：先 bigM，再 bigM_source
  *
  * @note 在写入数据前会自动调用Validate()验证配置的合法性
  * @note 求解器参数不再在CSV中生成，由求解器项目自行配置
  */
-void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
+std::vector<SectionRows> CaseGenerator::GenerateCsv(const GeneratorConfig& g, CaseWriter& w) {
     // 首先验证配置的合法性
-    Validate(g);
+    {
+        ScopedPhaseTimer timer("validate");
+        Validate(g);
+    }
+
+    // 每段写完后记录该段的行数
+    std::vector<SectionRows> sections;
+    uint64_t section_start = w.rowsWritten();
+    auto end_section = [&](const char* name) {
+        uint64_t rows = w.rowsWritten();
+        sections.push_back({name, rows - section_start});
+        section_start = rows;
+    };
 
     // ================================================================================
     // 1. 写出 meta 段 - 元数据
@@ -245,6 +278,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     w.writeRow("meta", "G", -1, -1, -1, -1, g.G);
     w.writeRow("meta", "T", -1, -1, -1, -1, g.T);
     w.writeRow("meta", "enable_transfer", -1, -1, -1, -1, g.enable_transfer ? 1 : 0);
+    end_section("meta");
 
     // ================================================================================
     // 2. 写出 family 段 - 物品-族关联矩阵
@@ -260,6 +294,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
             }
         }
     }
+    end_section("family");
 
     // ================================================================================
     // 3. 写出 cost 段 - 成本数据
@@ -269,6 +304,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     for (int i = 0; i < g.N; ++i) w.writeRow("cost", "cX", -1, -1, i, -1, g.cX[i]);
     for (int gg = 0; gg < g.G; ++gg) w.writeRow("cost", "cY", gg, -1, -1, -1, g.cY[gg]);
     for (int i = 0; i < g.N; ++i) w.writeRow("cost", "cI", -1, -1, i, -1, g.cI[i]);
+    end_section("cost");
 
     // ================================================================================
     // 4. 写出 cap_usage 段 - 产能占用数据
@@ -277,6 +313,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     // sY 按族索引（使用 u 字段存储族索引）
     for (int i = 0; i < g.N; ++i) w.writeRow("cap_usage", "sX", -1, -1, i, -1, g.sX[i]);
     for (int gg = 0; gg < g.G; ++gg) w.writeRow("cap_usage", "sY", gg, -1, -1, -1, g.sY[gg]);
+    end_section("cap_usage");
 
     // ================================================================================
     // 5. 写出 capacity 段 - 产能数据
@@ -290,6 +327,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     // 写出覆盖项（会覆盖上面的默认值）
     for (const auto& c : g.capacity_overrides)
         w.writeRow("capacity", "C", c.u, -1, -1, c.t, c.value);
+    end_section("capacity");
 
     // ================================================================================
     // 6. 写出 init 段 - 初始库存数据
@@ -302,6 +340,7 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     // 写出覆盖项（会覆盖上面的默认值）
     for (const auto& z : g.i0_overrides)
         w.writeRow("init", "I0", z.u, -1, z.i, -1, z.value);
+    end_section("init");
 
     // ================================================================================
     // 7. 写出 demand 段 - 需求数据（稀疏表示）
@@ -309,18 +348,49 @@ void CaseGenerator::GenerateCsv(const GeneratorConfig& g, CsvWriter& w) {
     // 只写出显式配置的需求点，未出现的默认为0
     for (const auto& d : g.demand)
         w.writeRow("demand", "Demand", d.u, -1, d.i, d.t, d.amount);
+    end_section("demand");
 
     // ================================================================================
     // 8. 写出 transfer 和 bigM 段（可选）
     // ================================================================================
     // 仅当启用转运功能时写出这两个段
     if (g.enable_transfer) {
-        // 写出转运成本数据
+        ScopedPhaseTimer timer("transfer");
+        const uint64_t rows_before = w.rowsWritten();
+
+        // 写出默认转运成本（对所有(u,v,i,t)生效）
+        w.writeRow("transfer", "cT_default", -1, -1, -1, -1, g.default_transfer_cost);
+
+        // 写出覆盖项（会覆盖上面的默认值）
         for (const auto& e : g.transfer_costs)
             w.writeRow("transfer", "cT", e.u, e.v, e.i, e.t, e.cost);
 
-        // 写出BigM约束数据
+        // 流式覆盖项：边产生边验证边写出，不在内存中展开
+        if (g.transfer_source) {
+            g.transfer_source([&](const TransferEntry& e) {
+                checkTransfer(g, e);
+                w.writeRow("transfer", "cT", e.u, e.v, e.i, e.t, e.cost);
+            });
+        }
+        end_section("transfer");
+
+        // 写出默认BigM值（对所有(i,t)生效）
+        w.writeRow("bigM", "M_default", -1, -1, -1, -1, g.default_bigM);
+
+        // 写出覆盖项（会覆盖上面的默认值）
         for (const auto& m : g.bigM)
             w.writeRow("bigM", "M", -1, -1, m.i, m.t, m.M);
+
+        if (g.bigM_source) {
+            g.bigM_source([&](const BigMEntry& m) {
+                checkBigM(g, m);
+                w.writeRow("bigM", "M", -1, -1, m.i, m.t, m.M);
+            });
+        }
+
+        end_section("bigM");
+
+        timer.addRows(w.rowsWritten() - rows_before);
     }
+    return sections;
 }
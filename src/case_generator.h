@@ -23,7 +23,9 @@
  */
 
 #pragma once
-#include "csv_writer.h"
+#include "case_writer.h"
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -90,6 +92,7 @@ struct I0Override {
  * 仅在启用转运功能时使用。
  *
  * @note 仅当 enable_transfer = true 时需要配置
+ * @note 如果不配置覆盖，将使用 default_transfer_cost
  */
 struct TransferEntry {
     int u;           // 源节点索引 (0-based)
@@ -108,6 +111,7 @@ struct TransferEntry {
  * BigM是一个足够大的常数，用于激活或关闭某些约束。
  *
  * @note 仅当 enable_transfer = true 时需要配置
+ * @note 如果不配置覆盖，将使用 default_bigM
  */
 struct BigMEntry {
     int i;           // 物品索引 (0-based)
@@ -115,6 +119,29 @@ struct BigMEntry {
     double M;        // BigM值（必须为正数且足够大）
 };
 
+/**
+ * @brief 转运成本覆盖项的流式来源
+ *
+ * @details
+ * 调用时通过 emit 逐条产生覆盖项；每次调用都应从头产生同样的序列。
+ * 用于 U×(U-1)×N×T 级别的逐条成本：覆盖项在写出时即时产生，不在内存中展开。
+ */
+using TransferSource = std::function<void(const std::function<void(const TransferEntry&)>& emit)>;
+
+/**
+ * @brief BigM覆盖项的流式来源（约定同 TransferSource）
+ */
+using BigMSource = std::function<void(const std::function<void(const BigMEntry&)>& emit)>;
+
+/**
+ * @struct SectionRows
+ * @brief  写出的一个数据段及其行数
+ */
+struct SectionRows {
+    std::string section;  ///< 段名称（meta、family、cost、...）
+    uint64_t rows = 0;    ///< 该段写出的行数
+};
+
 /**
  * @struct GeneratorConfig
  * @brief  算例生成器的完整配置
@@ -182,11 +209,25 @@ struct GeneratorConfig {
     // ================================================================================
     // 转运配置（仅当 enable_transfer=true 时需要）
     // ================================================================================
-    std::vector<TransferEntry> transfer_costs;  // 转运成本列表
-                                                // cT[u,v,i,t] 表示转运成本
+    double default_transfer_cost = 0.0;         // 默认转运成本
+                                                // 所有(u,v,i,t)组合的默认cT值
+
+    std::vector<TransferEntry> transfer_costs;  // 转运成本覆盖列表
+                                                // 用于设置特定(u,v,i,t)的cT值
+                                                // 未出现的组合使用 default_transfer_cost
 
-    std::vector<BigMEntry> bigM;                // BigM约束列表
-                                                // M[i,t] 表示BigM值
+    double default_bigM = 0.0;                  // 默认BigM值
+                                                // 所有(i,t)组合的默认M值（启用转运时必须为正）
+
+    std::vector<BigMEntry> bigM;                // BigM覆盖列表
+                                                // 用于设置特定(i,t)的M值
+                                                // 未出现的组合使用 default_bigM
+
+    TransferSource transfer_source;             // 可选：流式转运成本覆盖来源
+                                                // 写出时在 transfer_costs 之后即时产生
+
+    BigMSource bigM_source;                     // 可选：流式BigM覆盖来源
+                                                // 写出时在 bigM 之后即时产生
 };
 
 // ====================================================================================
@@ -229,10 +270,10 @@ public:
     static void Validate(const GeneratorConfig& gc);
 
     /**
-     * @brief 生成CSV算例文件
+     * @brief 生成算例文件
      *
      * @param gc 算例生成配置
-     * @param w  CSV写入器对象
+     * @param w  算例写入器（CsvWriter 或 BinaryCaseWriter）
      *
      * @throw std::runtime_error 当配置验证失败时抛出异常
      *
@@ -244,11 +285,13 @@ public:
      * 4. capacity  - 产能数据（默认值 + 覆盖）
      * 5. init      - 初始库存（默认值 + 覆盖）
      * 6. demand    - 需求数据（稀疏表示）
-     * 7. transfer  - 转运数据（可选，仅当enable_transfer=true）
-     * 8. bigM      - BigM约束（可选，仅当enable_transfer=true）
+     * 7. transfer  - 转运数据（可选，仅当enable_transfer=true；默认值 + 覆盖）
+     * 8. bigM      - BigM约束（可选，仅当enable_transfer=true；默认值 + 覆盖）
+     *
+     * @return std::vector<SectionRows> 按写出顺序的各段行数（未启用转运时不含 transfer、bigM）
      *
-     * @note 生成前会自动调用Validate()验证配置
+     * @note 生成前会自动调用Validate()验证配置；流式来源产生的覆盖项在写出时逐条验证
      * @note 求解器参数由求解器项目自行配置，不在CSV中生成
      */
-    static void GenerateCsv(const GeneratorConfig& gc, CsvWriter& w);
+    static std::vector<SectionRows> GenerateCsv(const GeneratorConfig& gc, CaseWriter& w);
 };
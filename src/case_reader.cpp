@@ -0,0 +1,616 @@
+/**
+ * ==================================================================================
+ * @file        case_reader.cpp
+ * @brief       算例读取器 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了：
+ * 1. CaseAssembler - 把数据行组装为 GeneratorConfig（覆盖语义、越界检查）
+ * 2. CaseReader::ParseCsv - 基于 string_view / from_chars 的零拷贝CSV解析
+ * 3. CaseReader::ParseBinary - 按块目录读取二进制列式算例
+ * 4. CaseReader::Load - 映射文件、识别格式并组装配置
+ * 5. CaseReader::LoadParallel - 按行边界分块并行解析，按文件顺序组装
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "case_reader.h"
+#include "binary_case_writer.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+// ====================================================================================
+// CaseAssembler 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 构造函数实现 - 清空目标配置
+ *
+ * @details 使用 clear() 而不是重新构造，批量读取时复用各向量已分配的内存。
+ */
+CaseAssembler::CaseAssembler(GeneratorConfig& gc) : gc_(gc) {
+    gc_.U = gc_.N = gc_.G = gc_.T = 0;
+    gc_.enable_transfer = false;
+    gc_.h_ig.clear();
+    gc_.cX.clear();
+    gc_.cY.clear();
+    gc_.cI.clear();
+    gc_.sX.clear();
+    gc_.sY.clear();
+    gc_.default_capacity = 0.0;
+    gc_.default_i0 = 0.0;
+    gc_.capacity_overrides.clear();
+    gc_.i0_overrides.clear();
+    gc_.demand.clear();
+    gc_.default_transfer_cost = 0.0;
+    gc_.transfer_costs.clear();
+    gc_.default_bigM = 0.0;
+    gc_.bigM.clear();
+    gc_.transfer_source = nullptr;
+    gc_.bigM_source = nullptr;
+}
+
+/**
+ * @brief 由 section/key 识别字段类型
+ */
+CaseAssembler::Field CaseAssembler::Classify(std::string_view section, std::string_view key) {
+    struct Entry { const char* section; const char* key; Field field; };
+    static const Entry kFields[] = {
+        {"meta", "U", Field::U},
+        {"meta", "N", Field::N},
+        {"meta", "G", Field::G},
+        {"meta", "T", Field::T},
+        {"meta", "enable_transfer", Field::EnableTransfer},
+        {"family", "h_ig", Field::Family},
+        {"cost", "cX", Field::CX},
+        {"cost", "cY", Field::CY},
+        {"cost", "cI", Field::CI},
+        {"cap_usage", "sX", Field::SX},
+        {"cap_usage", "sY", Field::SY},
+        {"capacity", "C", Field::Capacity},
+        {"init", "I0", Field::Init},
+        {"demand", "Demand", Field::Demand},
+        {"transfer", "cT_default", Field::TransferDefault},
+        {"transfer", "cT", Field::Transfer},
+        {"bigM", "M_default", Field::BigMDefault},
+        {"bigM", "M", Field::BigM},
+    };
+    for (const Entry& e : kFields) {
+        if (section == e.section && key == e.key) return e.field;
+    }
+    return Field::Unknown;
+}
+
+/**
+ * @brief 按 U/N/G/T 分配数组
+ */
+void CaseAssembler::ensureShape() {
+    if (shaped_) return;
+    if (gc_.U <= 0 || gc_.N <= 0 || gc_.G <= 0 || gc_.T <= 0) {
+        throw std::runtime_error("算例文件的meta段必须在数据段之前给出正的U/N/G/T");
+    }
+
+    const double kUnset = std::numeric_limits<double>::quiet_NaN();
+    gc_.h_ig.assign(static_cast<size_t>(gc_.N) * gc_.G, 0);
+    gc_.cX.assign(gc_.N, 0.0);
+    gc_.cY.assign(gc_.G, 0.0);
+    gc_.cI.assign(gc_.N, 0.0);
+    gc_.sX.assign(gc_.N, 0.0);
+    gc_.sY.assign(gc_.G, 0.0);
+    capacity_grid_.assign(static_cast<size_t>(gc_.U) * gc_.T, kUnset);
+    i0_grid_.assign(static_cast<size_t>(gc_.U) * gc_.N, kUnset);
+    shaped_ = true;
+}
+
+/**
+ * @brief 检查索引范围
+ */
+int CaseAssembler::checkIndex(int idx, int limit, const char* name) {
+    if (idx < 0 || idx >= limit) {
+        throw std::runtime_error(std::string("算例文件中的索引越界: ") + name + "=" +
+                                 std::to_string(idx));
+    }
+    return idx;
+}
+
+/**
+ * @brief 写入一行数据（整数值版本）
+ */
+void CaseAssembler::writeRow(std::string_view section, std::string_view key,
+                             int u, int v, int i, int t,
+                             int value) {
+    writeRow(section, key, u, v, i, t, static_cast<double>(value));
+}
+
+/**
+ * @brief 写入一行数据（浮点数值版本）
+ *
+ * @details
+ * meta 段以外的数据段需要 U/N/G/T 已知，第一次遇到时分配数组。
+ */
+void CaseAssembler::writeRow(std::string_view section, std::string_view key,
+                             int u, int v, int i, int t,
+                             double value) {
+    if (!has_field_ || section != last_section_ || key != last_key_) {
+        last_section_.assign(section);
+        last_key_.assign(key);
+        field_ = Classify(section, key);
+        has_field_ = true;
+    }
+
+    switch (field_) {
+        case Field::Unknown:
+            return;  // 不认识的行（如旧版本的 solver 段）忽略
+
+        // meta 段
+        case Field::U: gc_.U = static_cast<int>(value); return;
+        case Field::N: gc_.N = static_cast<int>(value); return;
+        case Field::G: gc_.G = static_cast<int>(value); return;
+        case Field::T: gc_.T = static_cast<int>(value); return;
+        case Field::EnableTransfer: gc_.enable_transfer = value != 0.0; return;
+
+        // 默认值行不依赖规模
+        case Field::TransferDefault: gc_.default_transfer_cost = value; return;
+        case Field::BigMDefault: gc_.default_bigM = value; return;
+
+        default:
+            break;
+    }
+
+    ensureShape();
+
+    switch (field_) {
+        case Field::Family:
+            gc_.h_ig[static_cast<size_t>(checkIndex(i, gc_.N, "i")) * gc_.G +
+                     checkIndex(u, gc_.G, "g")] = static_cast<int>(value);
+            break;
+        case Field::CX: gc_.cX[checkIndex(i, gc_.N, "i")] = value; break;
+        case Field::CY: gc_.cY[checkIndex(u, gc_.G, "g")] = value; break;
+        case Field::CI: gc_.cI[checkIndex(i, gc_.N, "i")] = value; break;
+        case Field::SX: gc_.sX[checkIndex(i, gc_.N, "i")] = value; break;
+        case Field::SY: gc_.sY[checkIndex(u, gc_.G, "g")] = value; break;
+
+        case Field::Capacity:
+            // 该段第一行的值作为默认值（GenerateCsv 先写出默认网格）
+            if (!has_capacity_) {
+                gc_.default_capacity = value;
+                has_capacity_ = true;
+            }
+            capacity_grid_[static_cast<size_t>(checkIndex(u, gc_.U, "u")) * gc_.T +
+                           checkIndex(t, gc_.T, "t")] = value;
+            break;
+
+        case Field::Init:
+            if (!has_i0_) {
+                gc_.default_i0 = value;
+                has_i0_ = true;
+            }
+            i0_grid_[static_cast<size_t>(checkIndex(u, gc_.U, "u")) * gc_.N +
+                     checkIndex(i, gc_.N, "i")] = value;
+            break;
+
+        case Field::Demand:
+            gc_.demand.push_back({checkIndex(u, gc_.U, "u"), checkIndex(i, gc_.N, "i"),
+                                  checkIndex(t, gc_.T, "t"), value});
+            break;
+
+        case Field::Transfer:
+            gc_.transfer_costs.push_back({checkIndex(u, gc_.U, "u"), checkIndex(v, gc_.U, "v"),
+                                          checkIndex(i, gc_.N, "i"), checkIndex(t, gc_.T, "t"),
+                                          value});
+            break;
+
+        case Field::BigM:
+            gc_.bigM.push_back({checkIndex(i, gc_.N, "i"), checkIndex(t, gc_.T, "t"), value});
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 完成组装
+ *
+ * @details
+ * capacity / init 网格中保存的是每个格子最后一次出现的值；
+ * 与默认值不同的格子整理为覆盖项，未出现的格子取默认值。
+ */
+void CaseAssembler::close() {
+    if (!shaped_) return;
+
+    for (int u = 0; u < gc_.U; ++u) {
+        for (int t = 0; t < gc_.T; ++t) {
+            double value = capacity_grid_[static_cast<size_t>(u) * gc_.T + t];
+            if (!std::isnan(value) && value != gc_.default_capacity) {
+                gc_.capacity_overrides.push_back({u, t, value});
+            }
+        }
+    }
+
+    for (int u = 0; u < gc_.U; ++u) {
+        for (int i = 0; i < gc_.N; ++i) {
+            double value = i0_grid_[static_cast<size_t>(u) * gc_.N + i];
+            if (!std::isnan(value) && value != gc_.default_i0) {
+                gc_.i0_overrides.push_back({u, i, value});
+            }
+        }
+    }
+}
+
+// ====================================================================================
+// CaseRowBuffer 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 缓存一行（整数值版本）
+ */
+void CaseRowBuffer::writeRow(std::string_view section, std::string_view key,
+                             int u, int v, int i, int t,
+                             int value) {
+    writeRow(section, key, u, v, i, t, static_cast<double>(value));
+}
+
+/**
+ * @brief 缓存一行（浮点数值版本）
+ */
+void CaseRowBuffer::writeRow(std::string_view section, std::string_view key,
+                             int u, int v, int i, int t,
+                             double value) {
+    if (runs_.empty() || runs_.back().section != section || runs_.back().key != key) {
+        runs_.push_back({std::string(section), std::string(key), rows_.size()});
+    }
+    rows_.push_back({u, v, i, t, value});
+}
+
+/**
+ * @brief 按写入顺序重放
+ */
+void CaseRowBuffer::replay(CaseWriter& sink) const {
+    for (size_t r = 0; r < runs_.size(); ++r) {
+        const Run& run = runs_[r];
+        size_t end = (r + 1 < runs_.size()) ? runs_[r + 1].begin : rows_.size();
+        for (size_t k = run.begin; k < end; ++k) {
+            const Row& row = rows_[k];
+            sink.writeRow(run.section, run.key, row.u, row.v, row.i, row.t, row.value);
+        }
+    }
+}
+
+// ====================================================================================
+// CSV 解析
+// ====================================================================================
+
+namespace {
+
+/**
+ * @brief 解析索引字段：空字段为-1
+ */
+bool ParseIndex(std::string_view s, int& out) {
+    if (s.empty()) {
+        out = -1;
+        return true;
+    }
+    auto res = std::from_chars(s.data(), s.data() + s.size(), out);
+    return res.ec == std::errc() && res.ptr == s.data() + s.size();
+}
+
+/**
+ * @brief 解析数值字段
+ */
+bool ParseValue(std::string_view s, double& out) {
+    auto res = std::from_chars(s.data(), s.data() + s.size(), out);
+    return res.ec == std::errc() && res.ptr == s.data() + s.size();
+}
+
+/**
+ * @brief 把一行切分为最多 max_fields 个字段
+ *
+ * @return size_t 字段个数（超过 max_fields 时返回 max_fields + 1）
+ *
+ * @details
+ * 带双引号的字段返回引号内的原始内容（不反转义 ""）；
+ * 本schema中的数值和已知 section/key 都不含引号，反转义没有意义。
+ */
+size_t SplitFields(std::string_view line, std::string_view* fields, size_t max_fields) {
+    size_t count = 0;
+    size_t pos = 0;
+    while (true) {
+        if (count == max_fields) return max_fields + 1;
+
+        if (pos < line.size() && line[pos] == '"') {
+            // 引号字段：找到未配对的结束引号
+            size_t start = pos + 1;
+            size_t k = start;
+            while (k < line.size()) {
+                if (line[k] == '"') {
+                    if (k + 1 < line.size() && line[k + 1] == '"') { k += 2; continue; }
+                    break;
+                }
+                ++k;
+            }
+            fields[count++] = line.substr(start, k - start);
+            pos = k + 1;  // 跳过结束引号
+            if (pos >= line.size()) return count;
+            if (line[pos] != ',') return max_fields + 1;  // 引号后必须是分隔符
+            ++pos;
+            continue;
+        }
+
+        size_t comma = line.find(',', pos);
+        if (comma == std::string_view::npos) {
+            fields[count++] = line.substr(pos);
+            return count;
+        }
+        fields[count++] = line.substr(pos, comma - pos);
+        pos = comma + 1;
+    }
+}
+
+/**
+ * @brief 按小端序读取一个值
+ */
+template <class T>
+T LoadLE(const char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    if constexpr (std::endian::native != std::endian::little) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (size_t k = 0; k < sizeof(T) / 2; ++k) {
+            std::swap(bytes[k], bytes[sizeof(T) - 1 - k]);
+        }
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+    return value;
+}
+
+}  // namespace
+
+/**
+ * @brief 解析CSV文本
+ */
+void CaseReader::ParseCsv(std::string_view text, CaseWriter& sink, size_t first_line) {
+    std::string_view fields[7];
+    size_t line_no = first_line;
+    size_t pos = 0;
+
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+        std::string_view line = text.substr(pos, end - pos);
+        pos = end + 1;
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (line.empty()) { ++line_no; continue; }
+
+        size_t count = SplitFields(line, fields, 7);
+        if (count == 7 && fields[0] == "section") { ++line_no; continue; }  // 表头
+        if (count != 7) {
+            throw std::runtime_error("算例文件第 " + std::to_string(line_no) +
+                                     " 行应有7个字段: " + std::string(line));
+        }
+
+        int idx[4];
+        double value;
+        for (int k = 0; k < 4; ++k) {
+            if (!ParseIndex(fields[2 + k], idx[k])) {
+                throw std::runtime_error("算例文件第 " + std::to_string(line_no) +
+                                         " 行的索引无法解析: " + std::string(fields[2 + k]));
+            }
+        }
+        if (!ParseValue(fields[6], value)) {
+            throw std::runtime_error("算例文件第 " + std::to_string(line_no) +
+                                     " 行的数值无法解析: " + std::string(fields[6]));
+        }
+
+        sink.writeRow(fields[0], fields[1], idx[0], idx[1], idx[2], idx[3], value);
+        ++line_no;
+    }
+}
+
+// ====================================================================================
+// 二进制解析
+// ====================================================================================
+
+/**
+ * @brief 判断数据是否为二进制算例格式
+ */
+bool CaseReader::IsBinary(std::string_view data) {
+    return data.size() >= sizeof(BinaryCaseFormat::kMagic) &&
+           std::memcmp(data.data(), BinaryCaseFormat::kMagic, sizeof(BinaryCaseFormat::kMagic)) == 0;
+}
+
+/**
+ * @brief 解析二进制算例
+ *
+ * @details
+ * 先读尾部定位块目录，逐项校验块的偏移和长度都落在数据区内，
+ * 再按块顺序把每一行交给 sink（块顺序即写出顺序，覆盖语义不变）。
+ */
+void CaseReader::ParseBinary(std::string_view data, CaseWriter& sink) {
+    using F = BinaryCaseFormat;
+    const char* base = data.data();
+    const size_t size = data.size();
+
+    if (size < F::kHeaderSize + F::kTrailerSize || !IsBinary(data)) {
+        throw std::runtime_error("不是有效的二进制算例文件");
+    }
+    if (LoadLE<uint32_t>(base + 8) != F::kVersion) {
+        throw std::runtime_error("不支持的二进制算例版本: " +
+                                 std::to_string(LoadLE<uint32_t>(base + 8)));
+    }
+
+    const char* trailer = base + size - F::kTrailerSize;
+    if (std::memcmp(trailer + 16, F::kEndMagic, sizeof(F::kEndMagic)) != 0) {
+        throw std::runtime_error("二进制算例文件不完整（缺少尾部）");
+    }
+    uint64_t footer_offset = LoadLE<uint64_t>(trailer);
+    uint64_t block_count = LoadLE<uint64_t>(trailer + 8);
+    const uint64_t footer_end = size - F::kTrailerSize;
+    if (footer_offset < F::kHeaderSize || footer_offset > footer_end) {
+        throw std::runtime_error("二进制算例文件的块目录偏移不合法");
+    }
+
+    uint64_t p = footer_offset;
+    auto need = [&](uint64_t n) {
+        if (n > footer_end - p) throw std::runtime_error("二进制算例文件的块目录被截断");
+    };
+
+    for (uint64_t b = 0; b < block_count; ++b) {
+        need(2);
+        uint16_t section_len = LoadLE<uint16_t>(base + p); p += 2;
+        need(section_len);
+        std::string_view section(base + p, section_len); p += section_len;
+        need(2);
+        uint16_t key_len = LoadLE<uint16_t>(base + p); p += 2;
+        need(key_len);
+        std::string_view key(base + p, key_len); p += key_len;
+        need(16);
+        uint64_t offset = LoadLE<uint64_t>(base + p);
+        uint64_t rows = LoadLE<uint64_t>(base + p + 8);
+        p += 16;
+
+        if (offset < F::kHeaderSize || offset > footer_offset ||
+            rows > (footer_offset - offset) / F::kBytesPerRow) {
+            throw std::runtime_error("二进制算例文件的数据块越界: " + std::string(section) +
+                                     "," + std::string(key));
+        }
+
+        const char* values = base + offset;
+        const char* cols[4];
+        for (int c = 0; c < 4; ++c) cols[c] = values + rows * 8 + rows * 4 * c;
+
+        for (uint64_t r = 0; r < rows; ++r) {
+            sink.writeRow(section, key,
+                          LoadLE<int32_t>(cols[0] + 4 * r), LoadLE<int32_t>(cols[1] + 4 * r),
+                          LoadLE<int32_t>(cols[2] + 4 * r), LoadLE<int32_t>(cols[3] + 4 * r),
+                          LoadLE<double>(values + 8 * r));
+        }
+    }
+}
+
+// ====================================================================================
+// 文件读取
+// ====================================================================================
+
+/**
+ * @brief 读取算例文件
+ */
+GeneratorConfig CaseReader::Load(const std::string& path) {
+    GeneratorConfig gc;
+    Load(path, gc);
+    return gc;
+}
+
+/**
+ * @brief 读取算例文件到已有的配置对象
+ */
+void CaseReader::Load(const std::string& path, GeneratorConfig& gc) {
+    MappedFile file(path);
+    CaseAssembler assembler(gc);
+
+    try {
+        if (IsBinary(file.view())) {
+            ParseBinary(file.view(), assembler);
+        } else {
+            ParseCsv(file.view(), assembler);
+        }
+    } catch (const std::exception& ex) {
+        throw std::runtime_error(path + ": " + ex.what());
+    }
+
+    assembler.close();
+}
+
+/**
+ * @brief 并行读取算例文件
+ *
+ * @details
+ * 1. 映射文件，按行边界切分为若干分块（分块在换行符之后结束）
+ * 2. 各分块在线程池上解析到各自的 CaseRowBuffer
+ * 3. 按分块顺序把缓存的行重放给 CaseAssembler，覆盖语义与顺序解析一致
+ *
+ * 分块解析失败时，按此前分块的换行数换算出文件行号，重新解析该分块以得到
+ * 与 Load() 相同的错误信息（只在出错时发生）。各分块的错误单独记录，全部分块
+ * 结束后按文件顺序重放：先重放失败分块之前的行（包括该分块出错前已解析的行），
+ * 再抛出该分块的错误，因此报告的总是顺序解析会遇到的第一个错误。
+ */
+void CaseReader::LoadParallel(const std::string& path, GeneratorConfig& gc, unsigned threads) {
+    if (threads == 0) threads = WorkStealingPool::DefaultThreads();
+
+    MappedFile file(path);
+    std::string_view text = file.view();
+
+    if (threads <= 1 || IsBinary(text) || text.size() < 2 * kMinChunkBytes) {
+        Load(path, gc);
+        return;
+    }
+
+    // 按行边界切分
+    size_t chunk_count = std::min<size_t>(static_cast<size_t>(threads) * 4,
+                                          text.size() / kMinChunkBytes);
+    size_t target = text.size() / chunk_count;
+    std::vector<std::string_view> chunks;
+    chunks.reserve(chunk_count);
+    size_t begin = 0;
+    while (begin < text.size()) {
+        size_t end = std::min(begin + target, text.size());
+        if (end < text.size()) {
+            size_t nl = text.find('\n', end);
+            end = (nl == std::string_view::npos) ? text.size() : nl + 1;
+        }
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+
+    // 并行解析
+    std::vector<CaseRowBuffer> buffers(chunks.size());
+    std::vector<std::exception_ptr> errors(chunks.size());
+    {
+        WorkStealingPool pool(threads);
+        for (size_t k = 0; k < chunks.size(); ++k) {
+            pool.submit([&, k] {
+                try {
+                    ParseCsv(chunks[k], buffers[k]);
+                } catch (const std::exception&) {
+                    // 换算出正确的起始行号后重新解析，记录带文件行号的错误
+                    size_t first_line = 1 + static_cast<size_t>(
+                        std::count(text.data(), chunks[k].data(), '\n'));
+                    try {
+                        CaseRowBuffer scratch;
+                        ParseCsv(chunks[k], scratch, first_line);
+                    } catch (const std::exception&) {
+                        errors[k] = std::current_exception();
+                        return;
+                    }
+                    errors[k] = std::current_exception();
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    // 按文件顺序组装，遇到第一个失败的分块时抛出它的错误
+    CaseAssembler assembler(gc);
+    try {
+        for (size_t k = 0; k < buffers.size(); ++k) {
+            buffers[k].replay(assembler);
+            if (errors[k]) std::rethrow_exception(errors[k]);
+        }
+    } catch (const std::exception& ex) {
+        throw std::runtime_error(path + ": " + ex.what());
+    }
+    assembler.close();
+}
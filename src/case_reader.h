@@ -0,0 +1,235 @@
+/**
+ * ==================================================================================
+ * @file        case_reader.h
+ * @brief       算例读取器 - 头文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * CaseReader 把 CsvWriter / BinaryCaseWriter 写出的算例文件读回 GeneratorConfig：
+ * - 文件通过 MappedFile 整体映射到内存，不逐行读取
+ * - CSV 字段以 std::string_view 指向映射内存，数值用 std::from_chars 解析，
+ *   每个字段不分配 std::string
+ * - 二进制格式（.lsgc，按文件头魔数识别）直接按块目录读取列数组
+ *
+ * 解析出的行交给 CaseAssembler（一个 CaseWriter），由它按与写出相反的规则组装配置：
+ * - capacity / init 段"后出现的行覆盖先出现的行"，组装为 默认值 + 与默认值不同的覆盖项
+ *   （默认值取该段第一行的值，即 GenerateCsv 写出的默认网格）
+ * - cT_default / M_default 设置默认转运成本和BigM，cT / M 按出现顺序作为覆盖项
+ * - 未知的 section/key（如旧版本的 solver 段）被忽略
+ *
+ * 大文件可用 LoadParallel：按行边界把CSV切成多个分块，在线程池上并行解析到
+ * CaseRowBuffer，再按文件顺序把各分块的行依次交给 CaseAssembler，覆盖语义不变。
+ *
+ * 使用示例：
+ * @code
+ * GeneratorConfig gc = CaseReader::Load("output/cases/case_20261016_120000.csv");
+ * CaseReader::LoadParallel("output/cases/case_big.csv", gc, 8);
+ * @endcode
+ *
+ * @note meta 段（U/N/G/T）必须位于其它数据段之前，GenerateCsv 写出的文件总是满足这一点
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "case_generator.h"
+#include "case_writer.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class CaseAssembler
+ * @brief 把 section,key,u,v,i,t,value 行组装为 GeneratorConfig 的写入器
+ *
+ * @details
+ * 连续多行 (section, key) 相同时只在第一行做字符串比较，
+ * 之后直接按缓存的字段类型分派。所有索引都做越界检查。
+ */
+class CaseAssembler : public CaseWriter {
+public:
+    /**
+     * @brief 构造函数 - 清空目标配置（保留其已分配的内存）
+     *
+     * @param gc 要填充的配置对象
+     */
+    explicit CaseAssembler(GeneratorConfig& gc);
+
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  int value) override;
+
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  double value) override;
+
+    /**
+     * @brief 完成组装：把 capacity / init 的最终网格整理为 默认值 + 覆盖项
+     */
+    void close() override;
+
+private:
+    /**
+     * @brief 已识别的 (section, key) 类型
+     */
+    enum class Field {
+        Unknown, U, N, G, T, EnableTransfer,
+        Family, CX, CY, CI, SX, SY,
+        Capacity, Init, Demand,
+        TransferDefault, Transfer, BigMDefault, BigM
+    };
+
+    GeneratorConfig& gc_;        ///< 目标配置
+
+    std::string last_section_;   ///< 上一行的 section
+    std::string last_key_;       ///< 上一行的 key
+    Field field_ = Field::Unknown;  ///< 上一行的字段类型
+    bool has_field_ = false;     ///< field_ 是否有效
+
+    bool shaped_ = false;        ///< 是否已按 U/N/G/T 分配数组
+    std::vector<double> capacity_grid_;  ///< 产能最终值（U×T，NaN 表示未出现）
+    std::vector<double> i0_grid_;        ///< 初始库存最终值（U×N，NaN 表示未出现）
+    bool has_capacity_ = false;  ///< capacity 段是否出现过
+    bool has_i0_ = false;        ///< init 段是否出现过
+
+    /**
+     * @brief 由 section/key 识别字段类型
+     */
+    static Field Classify(std::string_view section, std::string_view key);
+
+    /**
+     * @brief 第一次遇到数据段时按 U/N/G/T 分配数组
+     *
+     * @throw std::runtime_error 当 meta 段尚未给出正的 U/N/G/T 时抛出
+     */
+    void ensureShape();
+
+    /**
+     * @brief 检查索引范围 [0, limit)
+     *
+     * @throw std::runtime_error 越界时抛出
+     */
+    static int checkIndex(int idx, int limit, const char* name);
+};
+
+/**
+ * @class CaseRowBuffer
+ * @brief 按写入顺序缓存数据行的写入器（并行解析的分块结果）
+ *
+ * @details
+ * 连续的 (section, key) 行合并为一段，每段只保存一次名称；
+ * 每行只保存4个索引和值（24字节）。replay() 按原顺序把所有行交给另一个写入器。
+ */
+class CaseRowBuffer : public CaseWriter {
+public:
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  int value) override;
+
+    void writeRow(std::string_view section, std::string_view key,
+                  int u, int v, int i, int t,
+                  double value) override;
+
+    void close() override {}
+
+    /**
+     * @brief 按写入顺序把缓存的行交给 sink
+     */
+    void replay(CaseWriter& sink) const;
+
+    /**
+     * @brief 缓存的行数
+     */
+    size_t size() const { return rows_.size(); }
+
+private:
+    /**
+     * @struct Row
+     * @brief  一行的索引和值
+     */
+    struct Row {
+        int u, v, i, t;
+        double value;
+    };
+
+    /**
+     * @struct Run
+     * @brief  连续的同名行：rows_[begin, 下一段的begin)
+     */
+    struct Run {
+        std::string section;
+        std::string key;
+        size_t begin;
+    };
+
+    std::vector<Row> rows_;  ///< 所有行
+    std::vector<Run> runs_;  ///< 同名行分段
+};
+
+/**
+ * @class CaseReader
+ * @brief 算例文件读取器（静态类）
+ */
+class CaseReader {
+public:
+    /**
+     * @brief 读取算例文件
+     *
+     * @param path 算例文件路径（CSV 或 .lsgc 二进制格式，按内容自动识别）
+     * @return GeneratorConfig 组装好的配置
+     *
+     * @throw std::runtime_error 当文件无法读取或内容不合法时抛出
+     */
+    static GeneratorConfig Load(const std::string& path);
+
+    /**
+     * @brief 读取算例文件到已有的配置对象（复用其内存）
+     */
+    static void Load(const std::string& path, GeneratorConfig& gc);
+
+    /**
+     * @brief 并行读取算例文件
+     *
+     * @param path    算例文件路径
+     * @param gc      要填充的配置对象
+     * @param threads 线程数（0 表示全部硬件线程）
+     *
+     * @throw std::runtime_error 当文件无法读取或内容不合法时抛出（行号与顺序解析一致）
+     *
+     * @details
+     * CSV按行边界切分为约 4×threads 个分块（每块至少 kMinChunkBytes），
+     * 并行解析后按文件顺序组装。二进制文件、小文件或 threads=1 时退化为 Load()。
+     */
+    static void LoadParallel(const std::string& path, GeneratorConfig& gc, unsigned threads = 0);
+
+    /// 并行解析时每个分块的最小字节数
+    static constexpr size_t kMinChunkBytes = 1 << 20;
+
+    /**
+     * @brief 判断数据是否为二进制算例格式
+     */
+    static bool IsBinary(std::string_view data);
+
+    /**
+     * @brief 解析CSV文本，把每个数据行交给 sink
+     *
+     * @param text       CSV文本（可以是整个文件，也可以是按行边界切分的片段）
+     * @param sink       接收数据行的写入器
+     * @param first_line text 第一行在文件中的行号（用于错误信息）
+     *
+     * @throw std::runtime_error 当某行字段数不为7或数值无法解析时抛出，信息中包含行号
+     *
+     * @details
+     * 表头行（第一个字段为 "section"）和空行会被跳过，支持 \n 和 \r\n 换行。
+     */
+    static void ParseCsv(std::string_view text, CaseWriter& sink, size_t first_line = 1);
+
+    /**
+     * @brief 解析二进制算例，把每个数据行按块顺序交给 sink
+     *
+     * @throw std::runtime_error 当魔数、版本或块目录不合法时抛出
+     */
+    static void ParseBinary(std::string_view data, CaseWriter& sink);
+};
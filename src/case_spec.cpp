@@ -0,0 +1,458 @@
+/**
+ * ==================================================================================
+ * @file        case_spec.cpp
+ * @brief       算例规格构建与规格文件读取实现
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了：
+ * 1. CaseBuilder:    由 CaseSpec 构建 GeneratorConfig（原 main() 第七~九部分）
+ * 2. CaseSpecLoader: 解析规格文件，按 | 分隔的取值做笛卡尔积展开
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "case_spec.h"
+#include "phase_timer.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+// ====================================================================================
+// 内部辅助函数
+// ====================================================================================
+
+/**
+ * @brief 按分隔符切分字符串（保留空字段）
+ */
+static std::vector<std::string> split(const std::string& s, char sep) {
+    std::vector<std::string> parts;
+    std::string cur;
+    for (char c : s) {
+        if (c == sep) {
+            parts.push_back(cur);
+            cur.clear();
+        } else {
+            cur.push_back(c);
+        }
+    }
+    parts.push_back(cur);
+    return parts;
+}
+
+/**
+ * @brief 去除首尾空白字符
+ */
+static std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+/**
+ * @brief 解析整数，整个字符串必须是合法整数
+ */
+static long long parseInteger(const std::string& field, const std::string& text) {
+    size_t pos = 0;
+    long long v = 0;
+    try {
+        v = std::stoll(text, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != text.size()) {
+        throw std::runtime_error("规格字段 " + field + " 不是合法整数: " + text);
+    }
+    return v;
+}
+
+/**
+ * @brief 解析浮点数，整个字符串必须是合法的有限数值（拒绝 inf / nan）
+ */
+static double parseReal(const std::string& field, const std::string& text) {
+    size_t pos = 0;
+    double v = 0.0;
+    try {
+        v = std::stod(text, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != text.size() || !std::isfinite(v)) {
+        throw std::runtime_error("规格字段 " + field + " 不是合法数值: " + text);
+    }
+    return v;
+}
+
+/**
+ * @brief 解析布尔值（1/0/true/false）
+ */
+static bool parseBool(const std::string& field, const std::string& text) {
+    if (text == "1" || text == "true") return true;
+    if (text == "0" || text == "false") return false;
+    throw std::runtime_error("规格字段 " + field + " 不是合法布尔值: " + text);
+}
+
+/**
+ * @brief 规格文件中允许出现的字段名（与 CaseSpec 成员同名）
+ */
+static const char* const kSpecFields[] = {
+    "U", "N", "G", "T", "enable_transfer",
+    "default_capacity", "unit_sX", "unit_sY",
+    "capacity_utilization", "demand_intensity", "initial_inventory_ratio",
+    "time_concentration", "node_concentration", "item_concentration", "demand_size_variance",
+    "use_varied_costs", "unit_cX", "unit_cY", "unit_cI",
+    "cY_min", "cY_max", "cI_min", "cI_max", "transfer_cost", "transfer_cost_jitter", "seed",
+};
+
+/**
+ * @brief 检查字段名是否合法
+ */
+static bool isKnownField(const std::string& field) {
+    for (const char* f : kSpecFields) {
+        if (field == f) return true;
+    }
+    return false;
+}
+
+// ====================================================================================
+// CaseBuilder 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 由规格构建需求生成配置
+ */
+DemandGenConfig CaseBuilder::MakeDemandConfig(const CaseSpec& spec, unsigned demand_threads) {
+    DemandGenConfig demand_config;
+    demand_config.U = spec.U;
+    demand_config.N = spec.N;
+    demand_config.T = spec.T;
+    demand_config.default_capacity = spec.default_capacity;
+    demand_config.unit_sX = spec.unit_sX;
+    demand_config.unit_sY = spec.unit_sY;
+    demand_config.capacity_utilization = spec.capacity_utilization;
+    demand_config.demand_intensity = spec.demand_intensity;
+    demand_config.initial_inventory_ratio = spec.initial_inventory_ratio;
+    demand_config.time_concentration = spec.time_concentration;
+    demand_config.node_concentration = spec.node_concentration;
+    demand_config.item_concentration = spec.item_concentration;
+    demand_config.random_seed = spec.seed;
+    demand_config.demand_size_variance = spec.demand_size_variance;
+    demand_config.threads = demand_threads;
+    return demand_config;
+}
+
+/**
+ * @brief 由规格构建完整的算例配置
+ */
+CaseSummary CaseBuilder::Build(const CaseSpec& spec, GeneratorConfig& gc, unsigned demand_threads) {
+    ScopedPhaseTimer build_timer("build");
+
+    const int U = spec.U;
+    const int N = spec.N;
+    const int G = spec.G;
+    const int T = spec.T;
+
+    if (U <= 0 || N <= 0 || G <= 0 || T <= 0) {
+        throw std::runtime_error("规格不合法: U/N/G/T 必须为正整数");
+    }
+    if (spec.transfer_cost_jitter < 0.0 || spec.transfer_cost_jitter > 1.0) {
+        throw std::runtime_error("规格不合法: transfer_cost_jitter 必须在 [0,1] 内");
+    }
+
+    CaseSummary summary;
+
+    gc.U = U;
+    gc.N = N;
+    gc.G = G;
+    gc.T = T;
+    gc.enable_transfer = spec.enable_transfer;
+
+    // ================================================================================
+    // 1. 物品-族关联矩阵 h_ig
+    // ================================================================================
+    // 策略：将物品均匀分配到各个族，物品i分配到族(i % G)
+    gc.h_ig.assign(static_cast<size_t>(N) * G, 0);
+    for (int i = 0; i < N; ++i) {
+        gc.h_ig[static_cast<size_t>(i) * G + (i % G)] = 1;
+    }
+
+    // ================================================================================
+    // 2. 成本向量（cY 和 sY 按族，其余按物品）
+    // ================================================================================
+    gc.cY.clear();
+    gc.cI.clear();
+    if (spec.use_varied_costs) {
+        std::mt19937 cost_rng(spec.seed + 1000);
+        std::uniform_real_distribution<double> cY_dist(spec.cY_min, spec.cY_max);
+        std::uniform_real_distribution<double> cI_dist(spec.cI_min, spec.cI_max);
+
+        gc.cX.assign(N, spec.unit_cX);
+        for (int g = 0; g < G; ++g) gc.cY.push_back(cY_dist(cost_rng));
+        for (int i = 0; i < N; ++i) gc.cI.push_back(cI_dist(cost_rng));
+    } else {
+        gc.cX.assign(N, spec.unit_cX);
+        gc.cY.assign(G, spec.unit_cY);
+        gc.cI.assign(N, spec.unit_cI);
+    }
+
+    // ================================================================================
+    // 3. 产能占用、产能和初始库存
+    // ================================================================================
+    gc.sX.assign(N, spec.unit_sX);
+    gc.sY.assign(G, spec.unit_sY);
+    gc.default_capacity = spec.default_capacity;
+    gc.capacity_overrides.clear();
+    gc.i0_overrides.clear();
+
+    // 根据initial_inventory_ratio估算平均需求量，得到初始库存
+    // 注意：setup overhead 按族计算
+    double total_capacity = static_cast<double>(U) * T * spec.default_capacity;
+    double estimated_setup_overhead = static_cast<double>(U) * T * G * spec.demand_intensity * spec.unit_sY;
+    double available_production_capacity = total_capacity - estimated_setup_overhead;
+    double estimated_total_demand = available_production_capacity * spec.capacity_utilization / spec.unit_sX;
+    int estimated_demand_points = static_cast<int>(U * N * T * spec.demand_intensity);
+    double avg_demand = (estimated_demand_points > 0) ?
+                        (estimated_total_demand / estimated_demand_points) : 0;
+    gc.default_i0 = avg_demand * spec.initial_inventory_ratio;
+
+    // ================================================================================
+    // 4. 需求数据（产能驱动生成器）
+    // ================================================================================
+    {
+        ScopedPhaseTimer timer("demand");
+        DemandGenerator::Generate(MakeDemandConfig(spec, demand_threads), gc.demand,
+                                  summary.demand_stats);
+        timer.addRows(gc.demand.size());
+        summary.demand_nanos = timer.elapsedNanos();
+    }
+
+    summary.demand_count = gc.demand.size();
+    std::vector<double> period_volume(spec.T, 0.0);
+    for (const auto& d : gc.demand) {
+        summary.total_demand += d.amount;
+        period_volume[d.t] += d.amount;
+    }
+    if (total_capacity > 0) {
+        summary.actual_utilization = summary.total_demand * spec.unit_sX / total_capacity;
+    }
+    if (summary.total_demand > 0) {
+        double mean = summary.total_demand / spec.T;
+        double sum_sq = 0.0;
+        for (double v : period_volume) {
+            sum_sq += (v - mean) * (v - mean);
+        }
+        summary.period_volume_cv = std::sqrt(sum_sq / spec.T) / mean;
+    }
+
+    // ================================================================================
+    // 5. 转运成本和BigM数据（仅当启用转运功能时）
+    // ================================================================================
+    gc.default_transfer_cost = 0.0;
+    gc.default_bigM = 0.0;
+    gc.transfer_costs.clear();
+    gc.bigM.clear();
+    gc.transfer_source = nullptr;
+    gc.bigM_source = nullptr;
+    if (spec.enable_transfer) {
+        // 转运成本 cT[u,v,i,t]：统一成本只需一个默认值，无需逐条展开
+        gc.default_transfer_cost = spec.transfer_cost;
+
+        // 带扰动的逐条成本：U×(U-1)×N×T 条覆盖项在写出时由流式来源即时产生
+        if (spec.transfer_cost_jitter > 0.0) {
+            gc.transfer_source = [U, N, T, base = spec.transfer_cost, jitter = spec.transfer_cost_jitter,
+                                  seed = spec.seed](const std::function<void(const TransferEntry&)>& emit) {
+                std::mt19937 rng(seed + 2000);
+                std::uniform_real_distribution<double> dist(1.0 - jitter, 1.0 + jitter);
+                for (int u = 0; u < U; ++u)
+                    for (int v = 0; v < U; ++v) {
+                        if (u == v) continue;
+                        for (int i = 0; i < N; ++i)
+                            for (int t = 0; t < T; ++t)
+                                emit({u, v, i, t, base * dist(rng)});
+                    }
+            };
+            summary.transfer_count = static_cast<size_t>(U) * (U - 1) * N * T;
+        }
+
+        // BigM M[i,t]：设置为总需求的2倍（最小10000），统一值只需一个默认值
+        summary.bigM_value = std::max(10000.0, summary.total_demand * 2.0);
+        gc.default_bigM = summary.bigM_value;
+
+        summary.transfer_count += gc.transfer_costs.size();
+        summary.bigM_count = gc.bigM.size();
+    }
+
+    summary.build_nanos = build_timer.elapsedNanos();
+    return summary;
+}
+
+// ====================================================================================
+// CaseSpecLoader 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 按字段名设置规格参数
+ */
+void CaseSpecLoader::SetField(CaseSpec& spec, const std::string& field, const std::string& value) {
+    auto as_int = [&](int& dst) { dst = static_cast<int>(parseInteger(field, value)); };
+    auto as_real = [&](double& dst) { dst = parseReal(field, value); };
+    auto as_bool = [&](bool& dst) { dst = parseBool(field, value); };
+
+    if      (field == "U") as_int(spec.U);
+    else if (field == "N") as_int(spec.N);
+    else if (field == "G") as_int(spec.G);
+    else if (field == "T") as_int(spec.T);
+    else if (field == "enable_transfer") as_bool(spec.enable_transfer);
+    else if (field == "default_capacity") as_real(spec.default_capacity);
+    else if (field == "unit_sX") as_real(spec.unit_sX);
+    else if (field == "unit_sY") as_real(spec.unit_sY);
+    else if (field == "capacity_utilization") as_real(spec.capacity_utilization);
+    else if (field == "demand_intensity") as_real(spec.demand_intensity);
+    else if (field == "initial_inventory_ratio") as_real(spec.initial_inventory_ratio);
+    else if (field == "time_concentration") as_real(spec.time_concentration);
+    else if (field == "node_concentration") as_real(spec.node_concentration);
+    else if (field == "item_concentration") as_real(spec.item_concentration);
+    else if (field == "demand_size_variance") as_real(spec.demand_size_variance);
+    else if (field == "use_varied_costs") as_bool(spec.use_varied_costs);
+    else if (field == "unit_cX") as_real(spec.unit_cX);
+    else if (field == "unit_cY") as_real(spec.unit_cY);
+    else if (field == "unit_cI") as_real(spec.unit_cI);
+    else if (field == "cY_min") as_real(spec.cY_min);
+    else if (field == "cY_max") as_real(spec.cY_max);
+    else if (field == "cI_min") as_real(spec.cI_min);
+    else if (field == "cI_max") as_real(spec.cI_max);
+    else if (field == "transfer_cost") as_real(spec.transfer_cost);
+    else if (field == "transfer_cost_jitter") as_real(spec.transfer_cost_jitter);
+    else if (field == "seed") {
+        long long s = parseInteger(field, value);
+        if (s < 0) throw std::runtime_error("规格字段 seed 需为非负: " + value);
+        spec.seed = static_cast<unsigned int>(s);
+    }
+    else throw std::runtime_error("未知的规格字段: " + field);
+}
+
+/**
+ * @brief 从规格文件读取算例列表
+ *
+ * @details
+ * 每个数据行先按逗号切分为单元格，再把每个单元格按 | 切分为取值列表，
+ * 最后对所有取值列表做笛卡尔积（最后一列变化最快）。
+ */
+std::vector<CaseSpec> CaseSpecLoader::LoadFile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("无法打开规格文件: " + path);
+    }
+
+    std::vector<CaseSpec> specs;
+    std::vector<std::string> fields;
+    std::string line;
+    int line_no = 0;
+
+    while (std::getline(in, line)) {
+        ++line_no;
+        std::string content = trim(line);
+        if (content.empty() || content[0] == '#') continue;
+
+        std::vector<std::string> cells = split(content, ',');
+
+        // 第一行有效内容为字段名
+        if (fields.empty()) {
+            for (auto& c : cells) {
+                fields.push_back(trim(c));
+                if (!isKnownField(fields.back())) {
+                    throw std::runtime_error("未知的规格字段: " + fields.back());
+                }
+            }
+            continue;
+        }
+
+        if (cells.size() != fields.size()) {
+            throw std::runtime_error("规格文件第 " + std::to_string(line_no) +
+                                     " 行字段数与表头不一致");
+        }
+
+        std::vector<std::vector<std::string>> choices(cells.size());
+        for (size_t k = 0; k < cells.size(); ++k) {
+            for (auto& v : split(cells[k], '|')) {
+                std::string tv = trim(v);
+                if (!tv.empty()) choices[k].push_back(tv);
+            }
+        }
+
+        // 笛卡尔积展开（空单元格表示使用默认值）
+        std::function<void(size_t, CaseSpec)> expand = [&](size_t k, CaseSpec spec) {
+            if (k == choices.size()) {
+                specs.push_back(spec);
+                return;
+            }
+            if (choices[k].empty()) {
+                expand(k + 1, spec);
+                return;
+            }
+            for (const auto& v : choices[k]) {
+                CaseSpec next = spec;
+                SetField(next, fields[k], v);
+                expand(k + 1, next);
+            }
+        };
+
+        try {
+            expand(0, CaseSpec{});
+        } catch (const std::exception& ex) {
+            throw std::runtime_error("规格文件第 " + std::to_string(line_no) + " 行: " + ex.what());
+        }
+    }
+
+    return specs;
+}
+
+/**
+ * @brief 规格的全部字段（与规格文件字段同序）
+ */
+std::vector<std::pair<std::string, std::string>> CaseSpecLoader::Fields(const CaseSpec& spec) {
+    std::vector<std::pair<std::string, std::string>> fields;
+    auto add_int = [&](const char* name, long long value) { fields.emplace_back(name, std::to_string(value)); };
+    auto add_bool = [&](const char* name, bool value) { fields.emplace_back(name, value ? "true" : "false"); };
+    auto add_real = [&](const char* name, double value) {
+        char buf[32];
+        auto res = std::to_chars(buf, buf + sizeof(buf), value);
+        fields.emplace_back(name, std::string(buf, res.ptr));
+    };
+
+    add_int("U", spec.U);
+    add_int("N", spec.N);
+    add_int("G", spec.G);
+    add_int("T", spec.T);
+    add_bool("enable_transfer", spec.enable_transfer);
+    add_real("default_capacity", spec.default_capacity);
+    add_real("unit_sX", spec.unit_sX);
+    add_real("unit_sY", spec.unit_sY);
+    add_real("capacity_utilization", spec.capacity_utilization);
+    add_real("demand_intensity", spec.demand_intensity);
+    add_real("initial_inventory_ratio", spec.initial_inventory_ratio);
+    add_real("time_concentration", spec.time_concentration);
+    add_real("node_concentration", spec.node_concentration);
+    add_real("item_concentration", spec.item_concentration);
+    add_real("demand_size_variance", spec.demand_size_variance);
+    add_bool("use_varied_costs", spec.use_varied_costs);
+    add_real("unit_cX", spec.unit_cX);
+    add_real("unit_cY", spec.unit_cY);
+    add_real("unit_cI", spec.unit_cI);
+    add_real("cY_min", spec.cY_min);
+    add_real("cY_max", spec.cY_max);
+    add_real("cI_min", spec.cI_min);
+    add_real("cI_max", spec.cI_max);
+    add_real("transfer_cost", spec.transfer_cost);
+    add_real("transfer_cost_jitter", spec.transfer_cost_jitter);
+    add_int("seed", spec.seed);
+    return fields;
+}
@@ -0,0 +1,184 @@
+/**
+ * ==================================================================================
+ * @file        case_spec.h
+ * @brief       算例规格定义与构建接口
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件把原先写死在 main() 中的参数整理为 CaseSpec 结构体，
+ * 使单算例模式和批量模式共用同一套"规格 -> GeneratorConfig"构建逻辑。
+ *
+ * 核心组件：
+ * - CaseSpec:       一个算例的全部生成参数（规模、产能、需求、成本、种子）
+ * - CaseSummary:    构建完成后的统计信息（需求数、利用率、BigM等）
+ * - CaseBuilder:    由 CaseSpec 构建 DemandGenConfig / GeneratorConfig
+ * - CaseSpecLoader: 从规格文件读取算例列表（支持网格展开）
+ *
+ * 规格文件格式（CSV，首行为字段名，# 开头为注释）：
+ * @code
+ * U,N,G,T,seed,capacity_utilization
+ * 6,100,4,30,42,0.80
+ * 10|20,200,8,52,1|2|3,0.85
+ * @endcode
+ * 单元格中用 | 分隔的多个取值会按笛卡尔积展开，上例第二行展开为 2×3=6 个算例。
+ * 未出现的字段使用 CaseSpec 的默认值。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "case_generator.h"
+#include "demand_generator.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct CaseSpec
+ * @brief  单个算例的生成参数
+ *
+ * @note 默认值即 S1 规模的预设配置
+ */
+struct CaseSpec {
+    //--------------------------------------------------------------------------------
+    // 规模与功能开关
+    //--------------------------------------------------------------------------------
+    int U = 6;                            ///< 节点数量
+    int N = 100;                          ///< 物品种类数量
+    int G = 4;                            ///< 物品族数量
+    int T = 30;                           ///< 时间周期数量
+    bool enable_transfer = true;          ///< 是否启用节点间转运功能
+
+    //--------------------------------------------------------------------------------
+    // 产能参数
+    //--------------------------------------------------------------------------------
+    double default_capacity = 1440.0;     ///< 每节点每时段的默认产能
+    double unit_sX = 1.0;                 ///< 单位产品产能占用
+    double unit_sY = 120.0;               ///< 启动产能占用
+
+    //--------------------------------------------------------------------------------
+    // 需求生成参数
+    //--------------------------------------------------------------------------------
+    double capacity_utilization = 0.80;   ///< 目标产能利用率
+    double demand_intensity = 0.15;       ///< 需求密度
+    double initial_inventory_ratio = 0.0; ///< 初始库存比例
+
+    //--------------------------------------------------------------------------------
+    // 分布控制参数
+    //--------------------------------------------------------------------------------
+    double time_concentration = 0.2;      ///< 时间分布集中度
+    double node_concentration = 0.3;      ///< 节点分布集中度
+    double item_concentration = 0.3;      ///< 物品分布集中度
+    double demand_size_variance = 0.3;    ///< 需求量方差
+
+    //--------------------------------------------------------------------------------
+    // 成本参数
+    //--------------------------------------------------------------------------------
+    bool use_varied_costs = true;         ///< 是否使用变化的成本
+    double unit_cX = 1.0;                 ///< X方向生产成本
+    double unit_cY = 1.0;                 ///< Y方向启动成本
+    double unit_cI = 1.0;                 ///< 库存持有成本
+    double cY_min = 1.0;                  ///< Y方向成本最小值
+    double cY_max = 1.0;                  ///< Y方向成本最大值
+    double cI_min = 1.0;                  ///< 库存成本最小值
+    double cI_max = 1.0;                  ///< 库存成本最大值
+    double transfer_cost = 5.0;           ///< 基础转运成本
+    double transfer_cost_jitter = 0.0;    ///< 转运成本相对扰动幅度 [0,1]
+                                          ///< 0 = 统一成本（只写默认值）；
+                                          ///< >0 = 每个(u,v,i,t)的成本为 transfer_cost×(1±jitter)，
+                                          ///< 写出时流式产生（种子 seed+2000），不在内存中展开
+
+    //--------------------------------------------------------------------------------
+    // 随机种子
+    //--------------------------------------------------------------------------------
+    unsigned int seed = 42;               ///< 需求随机种子（成本使用 seed+1000）
+};
+
+/**
+ * @struct CaseSummary
+ * @brief  构建完成后的算例统计信息（用于日志）
+ */
+struct CaseSummary {
+    size_t demand_count = 0;          ///< 需求点数量
+    double total_demand = 0.0;        ///< 总需求量
+    double actual_utilization = 0.0;  ///< 实际产能利用率 (0.0-1.0)
+    double period_volume_cv = 0.0;    ///< 各时段需求总量的变异系数（标准差 / 均值）
+    size_t transfer_count = 0;        ///< 转运成本覆盖条目数（不含默认值）
+    size_t bigM_count = 0;            ///< BigM覆盖条目数（不含默认值）
+    double bigM_value = 0.0;          ///< BigM值
+    DemandGenStats demand_stats;      ///< 需求生成的退化路径统计
+    uint64_t build_nanos = 0;         ///< Build 耗时（纳秒）
+    uint64_t demand_nanos = 0;        ///< 其中需求生成的耗时（纳秒）
+};
+
+/**
+ * @class CaseBuilder
+ * @brief 由 CaseSpec 构建完整的 GeneratorConfig
+ *
+ * @note 所有方法都是静态的，不需要创建实例
+ */
+class CaseBuilder {
+public:
+    /**
+     * @brief 由规格构建需求生成配置
+     *
+     * @param spec           算例规格
+     * @param demand_threads 需求生成线程数（1 = 顺序，0 = 全部硬件线程）
+     */
+    static DemandGenConfig MakeDemandConfig(const CaseSpec& spec, unsigned demand_threads = 1);
+
+    /**
+     * @brief 由规格构建完整的算例配置
+     *
+     * @param spec 算例规格
+     * @param gc   输出的算例配置（原有内容会被清空，但保留已分配的容量）
+     * @param demand_threads 需求生成线程数（1 = 顺序，0 = 全部硬件线程；结果与线程数无关）
+     * @return CaseSummary 统计信息
+     *
+     * @details
+     * 依次填充物品-族关联、成本、产能占用、初始库存、需求、转运和BigM数据。
+     * 批量模式下重复使用同一个 gc 对象，避免每个算例重新分配内存。
+     */
+    static CaseSummary Build(const CaseSpec& spec, GeneratorConfig& gc, unsigned demand_threads = 1);
+};
+
+/**
+ * @class CaseSpecLoader
+ * @brief 读取和展开算例规格
+ *
+ * @note 所有方法都是静态的，不需要创建实例
+ */
+class CaseSpecLoader {
+public:
+    /**
+     * @brief 从规格文件读取算例列表
+     *
+     * @param path 规格文件路径
+     * @return std::vector<CaseSpec> 展开后的算例列表（按文件顺序）
+     *
+     * @throw std::runtime_error 文件无法打开、字段名未知或取值不合法时抛出
+     */
+    static std::vector<CaseSpec> LoadFile(const std::string& path);
+
+    /**
+     * @brief 按字段名设置规格参数
+     *
+     * @param spec  待修改的规格
+     * @param field 字段名（与 CaseSpec 成员同名）
+     * @param value 字段值（文本形式）
+     *
+     * @throw std::runtime_error 字段名未知或取值不合法时抛出
+     */
+    static void SetField(CaseSpec& spec, const std::string& field, const std::string& value);
+
+    /**
+     * @brief 规格的全部字段（与规格文件字段同序）
+     *
+     * @param spec 算例规格
+     * @return 字段名和文本值；数值为最短往返表示，布尔值为 true/false，均可由 SetField 读回
+     */
+    static std::vector<std::pair<std::string, std::string>> Fields(const CaseSpec& spec);
+};
@@ -0,0 +1,55 @@
+/**
+ * ==================================================================================
+ * @file        case_writer.cpp
+ * @brief       算例写入器接口 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 CaseWriter 的工厂方法和格式名称解析。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "case_writer.h"
+#include "binary_case_writer.h"
+#include "csv_writer.h"
+#include <stdexcept>
+
+/**
+ * @brief 按格式打开一个写入器
+ */
+std::unique_ptr<CaseWriter> CaseWriter::Open(const std::string& path, CaseFormat format,
+                                             const std::string& exact_floats) {
+    if (format == CaseFormat::Binary) {
+        return std::make_unique<BinaryCaseWriter>(path);
+    }
+
+    auto writer = std::make_unique<CsvWriter>(path);
+    if (!exact_floats.empty()) writer->setExactFloats(exact_floats);
+    return writer;
+}
+
+/**
+ * @brief 格式对应的文件扩展名
+ */
+const char* CaseWriter::Extension(CaseFormat format) {
+    return format == CaseFormat::Binary ? ".lsgc" : ".csv";
+}
+
+/**
+ * @brief 格式名称
+ */
+const char* CaseWriter::FormatName(CaseFormat format) {
+    return format == CaseFormat::Binary ? "binary" : "csv";
+}
+
+/**
+ * @brief 解析格式名称
+ */
+CaseFormat CaseWriter::ParseFormat(std::string_view name) {
+    if (name == "csv") return CaseFormat::Csv;
+    if (name == "binary" || name == "bin") return CaseFormat::Binary;
+    throw std::invalid_argument("未知的算例格式: " + std::string(name) + "（可选 csv 或 binary）");
+}
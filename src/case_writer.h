@@ -0,0 +1,117 @@
+/**
+ * ==================================================================================
+ * @file        case_writer.h
+ * @brief       算例写入器接口 - 头文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * CaseWriter 是算例写入器的抽象基类，CaseGenerator::GenerateCsv 通过它按
+ * section,key,u,v,i,t,value 的逻辑schema逐行写出算例。具体写入器：
+ * - CsvWriter:         文本CSV（默认，人工可读）
+ * - BinaryCaseWriter:  二进制列式格式（加载时只需少量 read/mmap，无需分词解析）
+ *
+ * 使用示例：
+ * @code
+ * auto writer = CaseWriter::Open("case.lsgc", CaseFormat::Binary);
+ * CaseGenerator::GenerateCsv(gc, *writer);
+ * writer->close();   // 显式关闭，写出失败时抛出异常
+ * @endcode
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * @enum  CaseFormat
+ * @brief 算例文件格式
+ */
+enum class CaseFormat {
+    Csv,     ///< 文本CSV: section,key,u,v,i,t,value
+    Binary   ///< 二进制列式格式（见 binary_case_writer.h）
+};
+
+/**
+ * @class CaseWriter
+ * @brief 算例写入器抽象基类
+ *
+ * @details
+ * 索引不适用时传-1。同一 (section, key) 的行应连续写出，
+ * 后写出的行覆盖先写出的行（默认值 + 覆盖项语义）。
+ */
+class CaseWriter {
+public:
+    virtual ~CaseWriter() = default;
+
+    /**
+     * @brief 写入一行数据（整数值）
+     */
+    virtual void writeRow(std::string_view section, std::string_view key,
+                          int u, int v, int i, int t,
+                          int value) = 0;
+
+    /**
+     * @brief 写入一行数据（浮点数值）
+     */
+    virtual void writeRow(std::string_view section, std::string_view key,
+                          int u, int v, int i, int t,
+                          double value) = 0;
+
+    /**
+     * @brief 完成写出并将数据写入磁盘
+     *
+     * @throw std::runtime_error 当写文件失败时抛出异常
+     *
+     * @details 析构函数也会完成写出，但会吞掉异常；需要发现写出错误时应显式调用。
+     */
+    virtual void close() = 0;
+
+    /**
+     * @brief 已写入的数据行数（不含表头）
+     */
+    uint64_t rowsWritten() const { return rows_written_; }
+
+    /**
+     * @brief 已产生的输出字节数（含尚在缓冲区中的部分；不写文件的写入器为0）
+     */
+    virtual uint64_t bytesWritten() const { return 0; }
+
+    /**
+     * @brief 按格式打开一个写入器
+     *
+     * @param path         输出文件路径
+     * @param format       文件格式
+     * @param exact_floats CSV格式的无损浮点输出key（见 CsvWriter::setExactFloats），
+     *                     为空时截断为整数；二进制格式总是无损，忽略此参数
+     *
+     * @throw std::runtime_error 当文件无法打开时抛出异常
+     */
+    static std::unique_ptr<CaseWriter> Open(const std::string& path, CaseFormat format,
+                                            const std::string& exact_floats = "");
+
+    /**
+     * @brief 格式对应的文件扩展名（".csv" 或 ".lsgc"）
+     */
+    static const char* Extension(CaseFormat format);
+
+    /**
+     * @brief 格式名称（"csv" 或 "binary"，可由 ParseFormat 读回）
+     */
+    static const char* FormatName(CaseFormat format);
+
+    /**
+     * @brief 解析格式名称（"csv" 或 "binary"）
+     *
+     * @throw std::invalid_argument 当名称无法识别时抛出异常
+     */
+    static CaseFormat ParseFormat(std::string_view name);
+
+protected:
+    uint64_t rows_written_ = 0;  ///< 已写入的数据行数（由具体写入器在 writeRow 中累加）
+};
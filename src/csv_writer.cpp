@@ -2,8 +2,8 @@
  * ==================================================================================
  * @file        csv_writer.cpp
  * @brief       CSV文件写入器 - 实现文件
- * @version     1.0.0
- * @date        2025-10-13
+ * @version     1.1.0
+ * @date        2026-10-16
  *
  * @description
  * 本文件实现了CsvWriter类的所有方法，包括：
@@ -12,6 +12,8 @@
  * - 数据行写入（支持多种类型）
  * - CSV特殊字符转义
  * - 空值处理
+ * - 缓冲区管理（整块写出）
+ * - 浮点数输出格式（截断 / 最短往返表示，可按 key 设置）
  *
  * CSV格式说明：
  * - 使用逗号作为字段分隔符
@@ -24,7 +26,8 @@
  */
 
 #include "csv_writer.h"
-#include <sstream>
+#include <charconv>
+#include <cstring>
 #include <stdexcept>
 
 // ====================================================================================
@@ -34,10 +37,16 @@
 /**
  * @brief 构造函数实现 - 打开文件准备写入
  */
-CsvWriter::CsvWriter(const std::string& path)
-    : ofs_(path, std::ios::out | std::ios::trunc) {
+CsvWriter::CsvWriter(const std::string& path, size_t buffer_size)
+    : path_(path), buf_(buffer_size < 256 ? 256 : buffer_size) {
+    // 关闭文件流自身的缓冲：数据已在 buf_ 中攒成大块，再缓冲一次只会多一次拷贝
+    // 注意：pubsetbuf 必须在 open 之前调用才能生效
+    ofs_.rdbuf()->pubsetbuf(nullptr, 0);
+
     // std::ios::out: 以写入模式打开
     // std::ios::trunc: 如果文件已存在，清空内容
+    // std::ios::binary: 按原样写出 '\n'，各平台输出逐字节一致
+    ofs_.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
 
     if (!ofs_) {
         // 文件打开失败，抛出异常
@@ -50,8 +59,50 @@ CsvWriter::CsvWriter(const std::string& path)
  */
 CsvWriter::~CsvWriter() {
     // flush确保缓冲区中的所有数据都写入磁盘
-    // 文件流会在对象销毁时自动关闭
+    // 析构函数不抛出异常，写入失败只能忽略
+    try {
+        flush();
+    } catch (...) {
+    }
+}
+
+// ====================================================================================
+// 缓冲区管理
+// ====================================================================================
+
+/**
+ * @brief 将缓冲区中的数据写入文件
+ */
+void CsvWriter::flush() {
+    if (len_ > 0) {
+        ofs_.write(buf_.data(), static_cast<std::streamsize>(len_));
+        flushed_bytes_ += len_;
+        len_ = 0;
+    }
     ofs_.flush();
+    if (!ofs_) {
+        throw std::runtime_error("写入输出文件失败: " + path_);
+    }
+}
+
+/**
+ * @brief 确保缓冲区至少还有 n 字节空间
+ */
+void CsvWriter::reserve(size_t n) {
+    if (len_ + n > buf_.size()) {
+        flush();
+        // 单个字段超过整个缓冲区时扩容（只会发生在超长字符串值上）
+        if (n > buf_.size()) buf_.resize(n);
+    }
+}
+
+/**
+ * @brief 追加原始字节
+ */
+void CsvWriter::append(std::string_view s) {
+    reserve(s.size());
+    std::memcpy(buf_.data() + len_, s.data(), s.size());
+    len_ += s.size();
 }
 
 // ====================================================================================
@@ -64,7 +115,7 @@ CsvWriter::~CsvWriter() {
 void CsvWriter::writeHeaderIfNeeded() {
     if (!wrote_header_) {
         // 写入固定的表头行
-        ofs_ << "section,key,u,v,i,t,value\n";
+        append("section,key,u,v,i,t,value\n");
         wrote_header_ = true;  // 标记表头已写入
     }
 }
@@ -74,61 +125,128 @@ void CsvWriter::writeHeaderIfNeeded() {
 // ====================================================================================
 
 /**
- * @brief CSV字符串转义实现
+ * @brief 判断字符串是否包含需要转义的字符
+ */
+bool CsvWriter::needsQuoting(std::string_view s) {
+    for (char c : s) {
+        if (c == ',' || c == '"' || c == '\n' || c == '\r') {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief CSV字段转义追加实现
  *
  * @details
  * 根据CSV标准规则对字符串进行转义：
  * 1. 检查是否包含特殊字符（逗号、双引号、换行、回车）
- * 2. 如果包含，则用双引号包围整个字符串
- * 3. 字符串内的双引号转义为两个双引号
+ * 2. 如果不包含，直接追加原字符串
+ * 3. 否则用双引号包围，字符串内的双引号转义为两个双引号
  */
-std::string CsvWriter::escape(const std::string& s) {
+void CsvWriter::appendEscaped(std::string_view s) {
     // 第一步：检查是否需要转义
-    bool need_quote = false;
-    for (char c : s) {
-        if (c == ',' || c == '"' || c == '\n' || c == '\r') {
-            need_quote = true;
-            break;
-        }
+    if (!needsQuoting(s)) {
+        append(s);
+        return;
     }
 
-    // 如果不包含特殊字符，直接返回原字符串
-    if (!need_quote) return s;
-
-    // 第二步：构建转义后的字符串
-    std::string out;
-    out.reserve(s.size() + 2);  // 预分配空间（至少需要原长度+2个双引号）
-
-    out.push_back('"');  // 开始双引号
+    // 第二步：最坏情况每个字符都是双引号，再加首尾两个双引号
+    reserve(s.size() * 2 + 2);
+    char* out = buf_.data() + len_;
 
+    *out++ = '"';  // 开始双引号
     for (char c : s) {
         if (c == '"') {
             // 双引号需要转义为两个双引号
-            out += "\"\"";
-        } else {
-            // 其他字符直接添加
-            out.push_back(c);
+            *out++ = '"';
         }
+        *out++ = c;
+    }
+    *out++ = '"';  // 结束双引号
+
+    len_ = static_cast<size_t>(out - buf_.data());
+}
+
+/**
+ * @brief 把转义后的字段追加到字符串末尾（规则同 appendEscaped）
+ */
+void CsvWriter::escapeInto(std::string& out, std::string_view s) {
+    if (!needsQuoting(s)) {
+        out.append(s);
+        return;
+    }
+    out += '"';
+    for (char c : s) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    out += '"';
+}
+
+/**
+ * @brief 追加 "section,key," 前缀
+ *
+ * @details
+ * GenerateCsv 中同一段的行是连续写出的（例如上万行 "demand,Demand,"），
+ * 与上一行相同时直接拷贝缓存的已转义前缀，不再逐字符检查转义。
+ */
+void CsvWriter::appendPrefix(std::string_view section, std::string_view key) {
+    if (!has_prefix_ || section != last_section_ || key != last_key_) {
+        last_section_.assign(section);
+        last_key_.assign(key);
+
+        // 转义一次并缓存结果
+        last_prefix_.clear();
+        escapeInto(last_prefix_, section);
+        last_prefix_ += ',';
+        escapeInto(last_prefix_, key);
+        last_prefix_ += ',';
+        key_float_format_ = floatFormatFor(key);
+        has_prefix_ = true;
     }
 
-    out.push_back('"');  // 结束双引号
+    append(last_prefix_);
+}
 
-    return out;
+/**
+ * @brief 追加整数（std::to_chars，无临时字符串）
+ */
+void CsvWriter::appendInt(long long val) {
+    reserve(24);
+    auto res = std::to_chars(buf_.data() + len_, buf_.data() + buf_.size(), val);
+    len_ = static_cast<size_t>(res.ptr - buf_.data());
 }
 
 /**
- * @brief 整数转字符串，-1转为空字符串
+ * @brief 追加浮点数的最短往返十进制表示
+ *
+ * @details
+ * std::to_chars 不指定格式和精度时，输出能被 from_chars / strtod
+ * 精确读回同一个 double 的最短字符串（整数值不带小数点，如 1440）。
+ * 最长约24个字符（如 -2.2250738585072014e-308）。
+ */
+void CsvWriter::appendDouble(double val) {
+    reserve(32);
+    auto res = std::to_chars(buf_.data() + len_, buf_.data() + buf_.size(), val);
+    len_ = static_cast<size_t>(res.ptr - buf_.data());
+}
+
+/**
+ * @brief 追加索引字段及其后的逗号，-1转为空字段
  *
  * @details
  * 在我们的CSV schema中，-1表示"不适用"的索引。
- * 在输出时，将-1转换为空字符串，使CSV更易读。
+ * 在输出时，将-1转换为空字段，使CSV更易读。
  *
  * 示例：
  * - meta段的行：section=meta时，u,v,i,t都不适用，显示为空
  * - cost段的行：section=cost时，u,v,t不适用，只有i有值
  */
-std::string CsvWriter::toStringOrEmpty(int val) {
-    return (val < 0) ? "" : std::to_string(val);
+void CsvWriter::appendIndex(int val) {
+    if (val >= 0) appendInt(val);
+    append(",");
 }
 
 // ====================================================================================
@@ -136,73 +254,152 @@ std::string CsvWriter::toStringOrEmpty(int val) {
 // ====================================================================================
 
 /**
- * @brief 写入一行数据（字符串值版本） - 核心实现
+ * @brief 写入一行数据（字符串值版本）
  *
  * @details
- * 这是所有writeRow重载的核心实现。
  * 执行步骤：
  * 1. 如果是第一次调用，先写入表头
- * 2. 对section和key进行转义
+ * 2. 写入 section,key, 前缀（与上一行相同时复用缓存）
  * 3. 将索引值转换（-1转为空）
  * 4. 对value进行转义
- * 5. 按CSV格式写入一行
  */
-void CsvWriter::writeRow(const std::string& section,
-                         const std::string& key,
+void CsvWriter::writeRow(std::string_view section,
+                         std::string_view key,
                          int u, int v, int i, int t,
-                         const std::string& value) {
+                         std::string_view value) {
     // 确保表头已写入
     writeHeaderIfNeeded();
+    ++rows_written_;
 
     // 按照 "section,key,u,v,i,t,value\n" 格式写入
-    // 注意：使用 escape() 转义可能包含特殊字符的字段
-    //       使用 toStringOrEmpty() 将-1转换为空字符串
-    ofs_  << escape(section) << ','     // section字段（可能包含特殊字符）
-          << escape(key)     << ','     // key字段（可能包含特殊字符）
-          << toStringOrEmpty(u) << ','  // u索引（-1显示为空）
-          << toStringOrEmpty(v) << ','  // v索引（-1显示为空）
-          << toStringOrEmpty(i) << ','  // i索引（-1显示为空）
-          << toStringOrEmpty(t) << ','  // t索引（-1显示为空）
-          << escape(value) << '\n';     // value字段（可能包含特殊字符）
+    appendPrefix(section, key);  // section和key字段（可能包含特殊字符）
+    appendIndex(u);              // u索引（-1显示为空）
+    appendIndex(v);              // v索引（-1显示为空）
+    appendIndex(i);              // i索引（-1显示为空）
+    appendIndex(t);              // t索引（-1显示为空）
+    appendEscaped(value);        // value字段（可能包含特殊字符）
+    append("\n");
 }
 
 /**
- * @brief 写入一行数据（整数值版本） - 便捷重载
+ * @brief 写入一行数据（整数值版本）
  *
  * @details
- * 将整数转换为字符串，然后调用字符串版本的writeRow。
- * 这个重载使得代码更简洁，不需要手动转换类型。
+ * 数值直接格式化到缓冲区，不经过字符串版本的writeRow。
+ * 数字不含需要转义的字符，因此跳过转义检查。
  */
-void CsvWriter::writeRow(const std::string& section, const std::string& key,
+void CsvWriter::writeRow(std::string_view section, std::string_view key,
                          int u, int v, int i, int t,
                          int value) {
-    // 将整数转换为字符串后调用字符串版本
-    writeRow(section, key, u, v, i, t, std::to_string(value));
+    writeHeaderIfNeeded();
+    ++rows_written_;
+
+    appendPrefix(section, key);
+    appendIndex(u);
+    appendIndex(v);
+    appendIndex(i);
+    appendIndex(t);
+    appendInt(value);
+    append("\n");
 }
 
 /**
- * @brief 写入一行数据（浮点数值版本） - 便捷重载
+ * @brief 写入一行数据（浮点数值版本）
  *
  * @details
- * 将浮点数强制转换为整数后写入。
- *
- * 注意：这个实现会丢失小数部分！
- * 原因：使用 static_cast<int>(value) 进行转换
- *
- * 如果需要保留小数部分，应该：
- * 1. 使用 std::to_string() 或 std::ostringstream 转换
- * 2. 然后调用字符串版本的 writeRow
- *
- * 当前实现适用于：
- * - 已知数据实际为整数，只是用double类型存储
- * - 不需要小数精度的场景
+ * 浮点格式由该行的 key 决定（前缀缓存时一并确定，连续同 key 的行不再查表）：
+ * - Truncate: 将浮点数强制转换为整数后写入，会丢失小数部分！
+ *   适用于已知数据实际为整数、只是用double类型存储的场景
+ * - Exact: 写出最短往返十进制表示，读回后与原值逐位相等
  */
-void CsvWriter::writeRow(const std::string& section, const std::string& key,
+void CsvWriter::writeRow(std::string_view section, std::string_view key,
                          int u, int v, int i, int t,
                          double value) {
-    // 浮点数转整数（截断小数部分）
-    int int_value = static_cast<int>(value);
+    writeHeaderIfNeeded();
+    ++rows_written_;
+
+    appendPrefix(section, key);
+    appendIndex(u);
+    appendIndex(v);
+    appendIndex(i);
+    appendIndex(t);
+    if (key_float_format_ == FloatFormat::Exact) {
+        appendDouble(value);
+    } else {
+        // 浮点数转整数（截断小数部分）
+        appendInt(static_cast<int>(value));
+    }
+    append("\n");
+}
 
-    // 调用整数版本
-    writeRow(section, key, u, v, i, t, std::to_string(int_value));
+// ====================================================================================
+// 浮点格式设置
+// ====================================================================================
+
+/**
+ * @brief 设置所有 key 的默认浮点格式
+ */
+void CsvWriter::setFloatFormat(FloatFormat format) {
+    default_float_format_ = format;
+    has_prefix_ = false;  // 使缓存的当前 key 格式失效
+}
+
+/**
+ * @brief 为单个 key 设置浮点格式
+ */
+void CsvWriter::setFloatFormat(std::string_view key, FloatFormat format) {
+    key_float_formats_[std::string(key)] = format;
+    has_prefix_ = false;
+}
+
+/**
+ * @brief 检查无损浮点输出的规格字符串
+ */
+void CsvWriter::ValidateExactFloats(std::string_view spec) {
+    if (spec.empty()) {
+        throw std::invalid_argument("无损浮点输出的key列表不能为空");
+    }
+    if (spec == "all") return;
+
+    size_t pos = 0;
+    while (pos <= spec.size()) {
+        size_t comma = spec.find(',', pos);
+        if (comma == std::string_view::npos) comma = spec.size();
+        if (comma == pos) {
+            throw std::invalid_argument("无损浮点输出的key列表包含空项: " + std::string(spec));
+        }
+        pos = comma + 1;
+    }
+}
+
+/**
+ * @brief 按规格字符串设置无损浮点输出
+ *
+ * @details
+ * - "all": 默认格式设为 Exact
+ * - "Demand,cI": 仅列出的 key 设为 Exact，其余 key 保持原格式
+ */
+void CsvWriter::setExactFloats(std::string_view spec) {
+    ValidateExactFloats(spec);
+    if (spec == "all") {
+        setFloatFormat(FloatFormat::Exact);
+        return;
+    }
+
+    size_t pos = 0;
+    while (pos <= spec.size()) {
+        size_t comma = spec.find(',', pos);
+        if (comma == std::string_view::npos) comma = spec.size();
+        setFloatFormat(spec.substr(pos, comma - pos), FloatFormat::Exact);
+        pos = comma + 1;
+    }
+}
+
+/**
+ * @brief 查找 key 的浮点格式（未单独设置时返回默认格式）
+ */
+CsvWriter::FloatFormat CsvWriter::floatFormatFor(std::string_view key) const {
+    if (key_float_formats_.empty()) return default_float_format_;
+    auto it = key_float_formats_.find(std::string(key));
+    return it != key_float_formats_.end() ? it->second : default_float_format_;
 }
@@ -2,8 +2,8 @@
  * ==================================================================================
  * @file        csv_writer.h
  * @brief       CSV文件写入器 - 头文件
- * @version     1.0.0
- * @date        2025-10-13
+ * @version     1.1.0
+ * @date        2026-10-16
  *
  * @description
  * CsvWriter 是一个专门用于写入固定schema的CSV文件的工具类。
@@ -19,6 +19,16 @@
  * - 线程不安全，单线程使用
  * - RAII风格，析构时自动flush
  *
+ * 性能设计（写出百万行级别的算例时格式化不成为瓶颈）：
+ * - section/key/value 以 std::string_view 传入，字符串字面量不再构造临时 std::string
+ * - 数值用 std::to_chars 直接格式化到写入器自有的缓冲区，不经过 std::to_string
+ * - 连续多行 section/key 相同时，复用上一行已转义好的 "section,key," 前缀
+ * - 缓冲区满（默认1 MiB）时整块写出，文件流本身不再做额外缓冲
+ *
+ * 浮点数输出格式（可按 key 单独设置）：
+ * - Truncate（默认）: 截断为整数，与早期版本输出一致
+ * - Exact: 最短往返十进制表示（std::to_chars），读回后与原 double 逐位相等
+ *
  * 使用示例：
  * @code
  * CsvWriter writer("output.csv");
@@ -35,8 +45,12 @@
  */
 
 #pragma once
+#include "case_writer.h"
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @class CsvWriter
@@ -53,12 +67,21 @@
  * - 使用-1表示空值
  * - 不可复制（防止文件句柄冲突）
  */
-class CsvWriter {
+class CsvWriter : public CaseWriter {
 public:
+    /**
+     * @brief 浮点数值的输出格式
+     */
+    enum class FloatFormat {
+        Truncate,  ///< 截断为整数（static_cast<int>）
+        Exact      ///< 最短往返十进制表示，无精度损失
+    };
+
     /**
      * @brief 构造函数 - 打开CSV文件准备写入
      *
-     * @param path 输出文件路径（相对或绝对路径）
+     * @param path        输出文件路径（相对或绝对路径）
+     * @param buffer_size 写缓冲区大小（字节），缓冲区满时整块写出
      *
      * @throw std::runtime_error 当文件无法打开时抛出异常
      *
@@ -66,7 +89,7 @@ public:
      * 以截断模式打开文件（如果文件已存在，会被清空）。
      * 构造函数不会立即写入表头，表头会在第一次调用writeRow时自动写入。
      */
-    explicit CsvWriter(const std::string& path);
+    explicit CsvWriter(const std::string& path, size_t buffer_size = kDefaultBufferSize);
 
     /**
      * @brief 析构函数 - 确保数据刷新到磁盘
@@ -75,7 +98,7 @@ public:
      * 析构时会自动flush缓冲区，确保所有数据都写入磁盘。
      * 不会抛出异常（符合析构函数最佳实践）。
      */
-    ~CsvWriter();
+    ~CsvWriter() override;
 
     // 禁用拷贝构造和拷贝赋值
     // 原因：避免多个对象持有同一个文件句柄，导致重复写入或关闭
@@ -94,7 +117,6 @@ public:
      * @param value   数据值（字符串形式）
      *
      * @details
-     * 核心写入方法，其他重载最终都会调用此方法。
      * 特殊字符处理：
      * - 如果字段包含逗号、双引号、换行符，会自动加双引号包围
      * - 字段内的双引号会被转义为两个双引号（CSV标准）
@@ -102,10 +124,21 @@ public:
      *
      * @note 第一次调用时会自动写入表头
      */
-    void writeRow(const std::string& section,
-                  const std::string& key,
+    void writeRow(std::string_view section,
+                  std::string_view key,
+                  int u, int v, int i, int t,
+                  std::string_view value);
+
+    /**
+     * @brief 写入一行数据（字符串值，const char* 重载）
+     *
+     * @details 避免字符串字面量值在 string_view 与 bool/int 重载之间产生歧义
+     */
+    void writeRow(std::string_view section, std::string_view key,
                   int u, int v, int i, int t,
-                  const std::string& value);
+                  const char* value) {
+        writeRow(section, key, u, v, i, t, std::string_view(value));
+    }
 
     /**
      * @brief 写入一行数据（整数值）
@@ -119,14 +152,14 @@ public:
      * @param value   数据值（整数）
      *
      * @details
-     * 便捷重载：将整数值转换为字符串后调用字符串版本的writeRow。
+     * 数值直接用 std::to_chars 格式化到缓冲区，不产生临时字符串。
      */
-    void writeRow(const std::string& section, const std::string& key,
+    void writeRow(std::string_view section, std::string_view key,
                   int u, int v, int i, int t,
-                  int value);
+                  int value) override;
 
     /**
-     * @brief 写入一行数据（浮点数值，转为整数）
+     * @brief 写入一行数据（浮点数值）
      *
      * @param section 数据段名称
      * @param key     数据键名
@@ -137,19 +170,90 @@ public:
      * @param value   数据值（浮点数）
      *
      * @details
-     * 便捷重载：将浮点数强制转换为整数后写入。
-     * @warning 会丢失小数部分（不是四舍五入，而是直接截断）
-     *
-     * @note 如果需要保留小数，请先转为字符串后使用字符串版本的writeRow
+     * 按该行 key 的浮点格式写入（见 setFloatFormat）：
+     * - Truncate: 将浮点数强制转换为整数后写入
+     * - Exact: 写出最短往返十进制表示（如 0.1、2.5、1440）
+     * @warning Truncate 会丢失小数部分（不是四舍五入，而是直接截断）
      */
-    void writeRow(const std::string& section, const std::string& key,
+    void writeRow(std::string_view section, std::string_view key,
                   int u, int v, int i, int t,
-                  double value);
+                  double value) override;
+
+    /**
+     * @brief 设置所有 key 的默认浮点格式
+     *
+     * @param format 浮点格式（未单独设置的 key 使用此格式）
+     */
+    void setFloatFormat(FloatFormat format);
+
+    /**
+     * @brief 为单个 key 设置浮点格式（覆盖默认格式）
+     *
+     * @param key    数据键名（如 "Demand", "cI"）
+     * @param format 浮点格式
+     */
+    void setFloatFormat(std::string_view key, FloatFormat format);
+
+    /**
+     * @brief 按规格字符串设置无损浮点输出
+     *
+     * @param spec "all" 表示全部 key 使用 Exact；
+     *             否则为逗号分隔的 key 列表（如 "Demand,cI,cY"），仅这些 key 使用 Exact
+     *
+     * @throw std::invalid_argument 当规格字符串为空或包含空 key 时抛出
+     */
+    void setExactFloats(std::string_view spec);
+
+    /**
+     * @brief 检查无损浮点输出的规格字符串（格式同 setExactFloats）
+     *
+     * @details
+     * 供命令行解析时提前检查，避免批量模式中每个算例打开写入器时才逐个失败。
+     *
+     * @throw std::invalid_argument 当规格字符串为空或包含空 key 时抛出
+     */
+    static void ValidateExactFloats(std::string_view spec);
+
+    /**
+     * @brief 将缓冲区中的数据写入文件
+     *
+     * @throw std::runtime_error 当写文件失败时抛出异常
+     */
+    void flush();
+
+    /**
+     * @brief 完成写出（等同于 flush）
+     *
+     * @throw std::runtime_error 当写文件失败时抛出异常
+     */
+    void close() override { flush(); }
+
+    /**
+     * @brief 已产生的CSV字节数（含表头和尚在缓冲区中的部分）
+     */
+    uint64_t bytesWritten() const override { return flushed_bytes_ + len_; }
+
+    /// 默认写缓冲区大小（1 MiB）
+    static constexpr size_t kDefaultBufferSize = 1 << 20;
 
 private:
-    std::ofstream ofs_;         ///< 输出文件流
+    std::ofstream ofs_;         ///< 输出文件流（无内部缓冲，由 buf_ 负责缓冲）
+    std::string path_;          ///< 输出文件路径（用于错误信息）
     bool wrote_header_ = false; ///< 表头是否已写入的标志
 
+    std::vector<char> buf_;     ///< 写缓冲区
+    size_t len_ = 0;            ///< 缓冲区中已填充的字节数
+    uint64_t flushed_bytes_ = 0; ///< 已从缓冲区写出到文件的字节数
+
+    std::string last_section_;  ///< 上一行的 section 原文
+    std::string last_key_;      ///< 上一行的 key 原文
+    std::string last_prefix_;   ///< 上一行已转义的 "section,key," 前缀
+    bool has_prefix_ = false;   ///< last_prefix_ 是否有效
+
+    FloatFormat default_float_format_ = FloatFormat::Truncate;       ///< 默认浮点格式
+    std::unordered_map<std::string, FloatFormat> key_float_formats_; ///< 按 key 的浮点格式
+    FloatFormat key_float_format_ = FloatFormat::Truncate;           ///< 当前 key 的浮点格式（随前缀缓存）
+
     /**
      * @brief 如果尚未写入表头，则写入表头
      *
@@ -160,33 +264,67 @@ private:
     void writeHeaderIfNeeded();
 
     /**
-     * @brief 对字符串进行CSV转义
-     *
-     * @param s 待转义的字符串
-     * @return std::string 转义后的字符串
+     * @brief 确保缓冲区至少还有 n 字节空间（不足时先写出）
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief 追加原始字节（不转义）
+     */
+    void append(std::string_view s);
+
+    /**
+     * @brief 追加一个字段（按CSV规则转义）
      *
      * @details
      * CSV转义规则：
      * - 如果字符串包含逗号、双引号、换行符或回车符，则用双引号包围
      * - 字符串内的双引号需要转义为两个双引号
-     * - 如果不包含特殊字符，则原样返回
+     * - 如果不包含特殊字符，则原样追加
      *
      * 示例：
      * - "hello" -> "hello"
      * - "hello,world" -> "\"hello,world\""
      * - "say \"hi\"" -> "\"say \"\"hi\"\"\""
      */
-    static std::string escape(const std::string& s);
+    void appendEscaped(std::string_view s);
 
     /**
-     * @brief 将整数转换为字符串，-1转换为空字符串
-     *
-     * @param val 整数值
-     * @return std::string 转换后的字符串（-1返回空字符串）
+     * @brief 追加 "section,key," 前缀；与上一行相同时直接复用已转义的前缀
+     */
+    void appendPrefix(std::string_view section, std::string_view key);
+
+    /**
+     * @brief 追加索引字段及其后的逗号，-1（负数）追加为空字段
      *
      * @details
      * 在CSV中，我们使用空字段表示"不适用"的索引。
      * 例如：meta段的数据不需要u,v,i,t索引，这些字段会显示为空。
      */
-    static std::string toStringOrEmpty(int val);
+    void appendIndex(int val);
+
+    /**
+     * @brief 追加整数（std::to_chars）
+     */
+    void appendInt(long long val);
+
+    /**
+     * @brief 追加浮点数的最短往返十进制表示（std::to_chars）
+     */
+    void appendDouble(double val);
+
+    /**
+     * @brief 查找 key 的浮点格式
+     */
+    FloatFormat floatFormatFor(std::string_view key) const;
+
+    /**
+     * @brief 判断字符串是否包含需要转义的字符
+     */
+    static bool needsQuoting(std::string_view s);
+
+    /**
+     * @brief 把转义后的字段追加到字符串末尾（用于生成缓存前缀）
+     */
+    static void escapeInto(std::string& out, std::string_view s);
 };
@@ -14,9 +14,93 @@
  */
 
 #include "demand_generator.h"
+#include "alias_sampler.h"
+#include "phase_timer.h"
+#include "thread_pool.h"
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <stdexcept>
 
+// ====================================================================================
+// 无放回采样辅助
+// ====================================================================================
+
+namespace {
+
+/// 拒绝采样的最大尝试次数，超过后改为顺序探测未选物品
+constexpr int kMaxSampleAttempts = 32;
+
+/// 并行生成时每个任务至少包含的需求点数（更小的算例顺序生成）
+constexpr size_t kMinPointsPerTask = 1 << 16;
+
+/// 需求总量相对目标产能的最大允许偏差
+constexpr double kUtilizationTolerance = 0.03;
+
+/// 检查总利用率所需的最少需求点数
+constexpr size_t kMinPointsForUtilizationCheck = 1000;
+
+/**
+ * @class CellKeySet
+ * @brief 某个(u,t)单元内已选物品的开放寻址哈希集合
+ *
+ * @details
+ * 容量为不小于 2×预期元素数的2的幂，线性探测。
+ * 只支持插入和查重，内存与该单元的需求点数成正比，与 N 无关。
+ */
+class CellKeySet {
+public:
+    explicit CellKeySet(size_t expected) {
+        size_t capacity = 16;
+        while (capacity < expected * 2) capacity *= 2;
+        slots_.assign(capacity, kEmpty);
+        mask_ = capacity - 1;
+    }
+
+    /**
+     * @brief 插入键
+     *
+     * @return bool 键原先不存在时返回 true
+     */
+    bool insert(uint64_t key) {
+        for (size_t pos = Mix(key) & mask_;; pos = (pos + 1) & mask_) {
+            if (slots_[pos] == key) return false;
+            if (slots_[pos] == kEmpty) {
+                slots_[pos] = key;
+                return true;
+            }
+        }
+    }
+
+private:
+    static constexpr uint64_t kEmpty = ~uint64_t{0};
+
+    std::vector<uint64_t> slots_;
+    size_t mask_ = 0;
+
+    /**
+     * @brief splitmix64 终混函数，打散相邻的键
+     */
+    static uint64_t Mix(uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+};
+
+/**
+ * @brief 需求生成的随机数流：(seed, u, t, stream)
+ */
+CounterRng StreamRng(const DemandGenConfig& config, DemandStream stream,
+                     uint32_t u = CounterRng::kNoIndex, uint32_t t = CounterRng::kNoIndex) {
+    return CounterRng(config.random_seed, u, t, static_cast<uint32_t>(stream));
+}
+
+}  // namespace
+
 // ====================================================================================
 // DemandGenerator 类实现
 // ====================================================================================
@@ -26,9 +110,27 @@
  */
 std::vector<DemandEntry> DemandGenerator::Generate(const DemandGenConfig& config) {
     std::vector<DemandEntry> demands;
+    Generate(config, demands);
+    return demands;
+}
 
-    // 步骤1：初始化随机数生成器
-    std::mt19937 rng(config.random_seed);
+/**
+ * @brief 使用产能驱动方法生成需求（写入已有容器）
+ */
+void DemandGenerator::Generate(const DemandGenConfig& config, std::vector<DemandEntry>& demands) {
+    DemandGenStats stats;
+    Generate(config, demands, stats);
+}
+
+/**
+ * @brief 使用产能驱动方法生成需求，并返回退化路径统计
+ */
+void DemandGenerator::Generate(const DemandGenConfig& config, std::vector<DemandEntry>& demands,
+                               DemandGenStats& stats) {
+    demands.clear();
+    stats = DemandGenStats{};
+
+    // 步骤1：各类随机数取自按 (seed, u, t, stream) 划分的独立流，见 DemandStream
 
     // 步骤2：计算需要生成的总需求点数
     int total_demand_points = static_cast<int>(
@@ -36,30 +138,39 @@ std::vector<DemandEntry> DemandGenerator::Generate(const DemandGenConfig& config
     );
 
     if (total_demand_points == 0) {
-        return demands;  // 无需求要生成
+        return;  // 无需求要生成
     }
+    stats.requested_points = static_cast<uint64_t>(total_demand_points);
 
-    // 步骤3：计算每个(节点, 时段)的可用产能
-    std::map<std::pair<int,int>, double> available_capacity;
-    CalculateAvailableCapacity(config, available_capacity);
-
-    // 步骤4：生成时段权重（控制时间集中度）
+    CapacityGrid available_capacity;
     std::vector<double> period_weights;
-    GeneratePeriodWeights(config, rng, period_weights);
-
-    // 步骤5：生成节点权重（控制节点集中度）
     std::vector<double> node_weights;
-    GenerateNodeWeights(config, rng, node_weights);
+    {
+        ScopedPhaseTimer timer("weights");
+
+        // 步骤3：计算每个(节点, 时段)的可用产能
+        CalculateAvailableCapacity(config, available_capacity);
+
+        // 步骤4：生成时段权重（控制时间集中度）
+        CounterRng period_rng = StreamRng(config, DemandStream::PeriodWeights);
+        GeneratePeriodWeights(config, period_rng, period_weights);
+
+        // 步骤5：生成节点权重（控制节点集中度）
+        CounterRng node_rng = StreamRng(config, DemandStream::NodeWeights);
+        GenerateNodeWeights(config, node_rng, node_weights);
+    }
 
     // 步骤6：使用分配的产能生成需求点
-    GenerateDemandPoints(config, rng, available_capacity,
+    GenerateDemandPoints(config, available_capacity,
                        period_weights, node_weights,
-                       total_demand_points, demands);
+                       total_demand_points, demands, stats);
+    stats.generated_points = demands.size();
+    stats.dropped_points = stats.requested_points - stats.generated_points;
 
     // 步骤7：验证可行性（健全性检查）
+    ScopedPhaseTimer timer("feasibility");
     VerifyFeasibility(config, demands, available_capacity);
-
-    return demands;
+    timer.addRows(demands.size());
 }
 
 //------------------------------------------------------------------------------------
@@ -71,7 +182,7 @@ std::vector<DemandEntry> DemandGenerator::Generate(const DemandGenConfig& config
  */
 void DemandGenerator::CalculateAvailableCapacity(
     const DemandGenConfig& config,
-    std::map<std::pair<int,int>, double>& available_capacity
+    CapacityGrid& available_capacity
 ) {
     // 估算每个时段的平均启动次数
     // 假设：每种物品类型每个时段可能启动一次
@@ -82,22 +193,18 @@ void DemandGenerator::CalculateAvailableCapacity(
     double setup_overhead = avg_setups_per_period * config.unit_sY;
 
     // 计算每个(节点, 时段)的可用产能
-    for (int u = 0; u < config.U; ++u) {
-        for (int t = 0; t < config.T; ++t) {
-            double total_cap = config.default_capacity;
-            double available_cap = total_cap - setup_overhead;
+    // 所有单元使用相同的默认产能，计算一次后填满整个网格
+    double total_cap = config.default_capacity;
+    double available_cap = total_cap - setup_overhead;
 
-            // 确保非负产能
-            if (available_cap < 0) {
-                available_cap = 0;
-            }
-
-            // 应用目标产能利用率
-            available_cap *= config.capacity_utilization;
-
-            available_capacity[{u, t}] = available_cap;
-        }
+    // 确保非负产能
+    if (available_cap < 0) {
+        available_cap = 0;
     }
+
+    // 目标产能利用率不在这里应用：它决定需求总量，而单元的上限是全部生产产能，
+    // 热门单元因此可以高于平均利用率，需求量才会随集中度在单元间转移
+    available_capacity.assign(config.U, config.T, available_cap);
 }
 
 //------------------------------------------------------------------------------------
@@ -109,7 +216,7 @@ void DemandGenerator::CalculateAvailableCapacity(
  */
 void DemandGenerator::GeneratePeriodWeights(
     const DemandGenConfig& config,
-    std::mt19937& rng,
+    CounterRng& rng,
     std::vector<double>& weights
 ) {
     weights.resize(config.T);
@@ -147,7 +254,7 @@ void DemandGenerator::GeneratePeriodWeights(
  */
 void DemandGenerator::GenerateNodeWeights(
     const DemandGenConfig& config,
-    std::mt19937& rng,
+    CounterRng& rng,
     std::vector<double>& weights
 ) {
     weights.resize(config.U);
@@ -180,6 +287,38 @@ void DemandGenerator::GenerateNodeWeights(
     }
 }
 
+/**
+ * @brief 根据物品集中度生成物品权重
+ */
+void DemandGenerator::GenerateItemWeights(
+    const DemandGenConfig& config,
+    CounterRng& rng,
+    std::vector<double>& weights
+) {
+    weights.resize(config.N);
+
+    if (config.item_concentration == 0.0) {
+        // 均匀分布
+        for (int i = 0; i < config.N; ++i) {
+            weights[i] = 1.0 / config.N;
+        }
+    } else {
+        // 集中分布
+        std::uniform_real_distribution<double> dist(0.5, 1.5);
+        double total = 0.0;
+        for (int i = 0; i < config.N; ++i) {
+            double base_weight = dist(rng);
+            double weight = std::pow(base_weight,
+                1.0 + config.item_concentration * 3.0);
+            weights[i] = weight;
+            total += weight;
+        }
+        for (int i = 0; i < config.N; ++i) {
+            weights[i] /= total;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------------
 // 需求点生成
 //------------------------------------------------------------------------------------
@@ -189,119 +328,292 @@ void DemandGenerator::GenerateNodeWeights(
  */
 void DemandGenerator::GenerateDemandPoints(
     const DemandGenConfig& config,
-    std::mt19937& rng,
-    std::map<std::pair<int,int>, double>& available_capacity,
+    const CapacityGrid& available_capacity,
     const std::vector<double>& period_weights,
     const std::vector<double>& node_weights,
     int total_demand_points,
-    std::vector<DemandEntry>& demands
+    std::vector<DemandEntry>& demands,
+    DemandGenStats& stats
 ) {
     // 计算总可用产能
     double total_capacity = 0.0;
-    for (const auto& entry : available_capacity) {
-        total_capacity += entry.second;
+    for (double cap : available_capacity.cells) {
+        total_capacity += cap;
     }
 
     if (total_capacity <= 0) {
         return;  // 无可用产能
     }
 
-    // 计算期望的平均需求量
-    double avg_demand_capacity = total_capacity / total_demand_points;
-    double avg_demand_amount = avg_demand_capacity / config.unit_sX;
-
-    // 根据方差计算需求量范围
-    double min_demand = avg_demand_amount * (1.0 - config.demand_size_variance);
-    double max_demand = avg_demand_amount * (1.0 + config.demand_size_variance);
+    // 需求总量 = 目标产能利用率 × 总生产产能（按需求量单位）
+    double total_volume = total_capacity * config.capacity_utilization / config.unit_sX;
+
+    // 生成带集中度控制的物品权重，别名表采样器用于选择（每次抽样 O(1)）
+    AliasSampler item_dist = [&] {
+        ScopedPhaseTimer timer("weights");
+        std::vector<double> item_weights;
+        CounterRng item_rng = StreamRng(config, DemandStream::ItemWeights);
+        GenerateItemWeights(config, item_rng, item_weights);
+        return AliasSampler(item_weights);
+    }();
+
+    // 每个(u,t)最多容纳的需求点数：物品各不相同（≤N），且每点至少1单位（≤产能/sX）
+    const size_t cell_count = available_capacity.cells.size();
+    std::vector<int> slots(cell_count);
+    double total_slots = 0.0;
+    for (size_t c = 0; c < cell_count; ++c) {
+        double cell_slots = std::floor(available_capacity.cells[c] / config.unit_sX);
+        slots[c] = static_cast<int>(std::clamp(cell_slots, 0.0, static_cast<double>(config.N)));
+        total_slots += slots[c];
+    }
 
-    // 确保正数边界
-    min_demand = std::max(1.0, min_demand);
-    max_demand = std::max(min_demand + 1.0, max_demand);
+    // 产能不足以容纳全部需求点时只能生成 total_slots 个
+    const int point_count = static_cast<int>(
+        std::min(static_cast<double>(total_demand_points), total_slots));
+
+    // 按 节点×时段 权重把需求点数分配到各(u,t)
+    std::vector<int> cell_points;
+    {
+        ScopedPhaseTimer timer("allocate");
+        AllocateCellPoints(config, available_capacity, period_weights, node_weights,
+                           slots, point_count, cell_points, stats);
+        timer.addRows(cell_count);
+    }
 
-    std::uniform_real_distribution<double> amount_dist(min_demand, max_demand);
+    // 按 节点×时段 权重把需求总量分配到有需求点的(u,t)，超出单元产能的部分注水到其余单元
+    std::vector<double> cell_volumes;
+    AllocateCellVolumes(config, available_capacity, period_weights, node_weights,
+                        cell_points, total_volume, cell_volumes);
 
-    // 生成带集中度控制的物品权重
-    std::vector<double> item_weights(config.N);
-    if (config.item_concentration == 0.0) {
-        // 均匀分布
-        for (int i = 0; i < config.N; ++i) {
-            item_weights[i] = 1.0 / config.N;
-        }
-    } else {
-        // 集中分布
-        std::uniform_real_distribution<double> dist(0.5, 1.5);
-        double total = 0.0;
-        for (int i = 0; i < config.N; ++i) {
-            double base_weight = dist(rng);
-            double weight = std::pow(base_weight,
-                1.0 + config.item_concentration * 3.0);
-            item_weights[i] = weight;
-            total += weight;
+    // 各(u,t)的输出位置由点数前缀和确定，按 u 为主序、t 为次序排列
+    std::vector<size_t> offsets(cell_count + 1, 0);
+    for (size_t c = 0; c < cell_count; ++c) {
+        offsets[c + 1] = offsets[c] + static_cast<size_t>(cell_points[c]);
+    }
+    const size_t first = demands.size();
+    demands.resize(first + static_cast<size_t>(point_count));
+    DemandEntry* out = demands.data() + first;
+
+    // 生成 [begin, end) 区间内的单元，各自写入自己的输出位置
+    // 统计先计入栈上的局部副本，结束时一次性累加到 range_stats：
+    // 相邻任务的 range_stats 位于同一数组中，热循环直接自增会在缓存行上互相争用
+    auto generate_range = [&](size_t begin, size_t end, DemandGenStats& range_stats) {
+        ScopedPhaseTimer timer("points");
+        timer.addRows(offsets[end] - offsets[begin]);
+        DemandGenStats local_stats;
+        for (size_t c = begin; c < end; ++c) {
+            if (cell_points[c] == 0) continue;
+            int u = static_cast<int>(c / available_capacity.T);
+            int t = static_cast<int>(c % available_capacity.T);
+            GenerateCellDemands(config, item_dist, cell_volumes[c],
+                                available_capacity.cells[c] / config.unit_sX,
+                                u, t, cell_points[c], out + offsets[c], local_stats);
         }
-        for (int i = 0; i < config.N; ++i) {
-            item_weights[i] /= total;
+        range_stats.merge(local_stats);
+    };
+
+    unsigned threads = config.threads == 0 ? WorkStealingPool::DefaultThreads() : config.threads;
+    size_t task_count = std::min<size_t>(static_cast<size_t>(threads) * 4,
+                                         static_cast<size_t>(point_count) / kMinPointsPerTask);
+    if (threads <= 1 || task_count <= 1) {
+        generate_range(0, cell_count, stats);
+        return;
+    }
+
+    // 按需求点数把单元划分为 task_count 个连续区间，工作窃取平衡剩余负载
+    // 每个单元只使用自己的随机数流，结果与顺序生成逐位一致；统计按任务分开计数，全部完成后按任务顺序合并
+    WorkStealingPool pool(threads);
+    std::vector<DemandGenStats> task_stats(task_count);
+    size_t begin = 0;
+    for (size_t k = 1; k <= task_count && begin < cell_count; ++k) {
+        size_t target = static_cast<size_t>(point_count) * k / task_count;
+        size_t end = k == task_count ? cell_count
+            : static_cast<size_t>(std::lower_bound(offsets.begin() + begin + 1, offsets.end(), target)
+                                  - offsets.begin());
+        end = std::min(end, cell_count);
+        if (end > begin) {
+            DemandGenStats* range_stats = &task_stats[k - 1];
+            pool.submit([&generate_range, begin, end, range_stats] {
+                generate_range(begin, end, *range_stats);
+            });
         }
+        begin = end;
     }
+    pool.wait();
+    for (const DemandGenStats& range_stats : task_stats) stats.merge(range_stats);
+}
 
-    // 离散分布用于选择
-    std::discrete_distribution<int> time_dist(
-        period_weights.begin(), period_weights.end());
-    std::discrete_distribution<int> node_dist(
-        node_weights.begin(), node_weights.end());
-    std::discrete_distribution<int> item_dist_weighted(
-        item_weights.begin(), item_weights.end());
-
-    // 跟踪每个(u,t)的产能使用情况
-    std::map<std::pair<int,int>, double> used_capacity;
-
-    // 生成需求点
-    for (int idx = 0; idx < total_demand_points; ++idx) {
-        // 选择时间段
-        int t = time_dist(rng);
-
-        // 选择节点
-        int u = node_dist(rng);
-
-        // 选择物品
-        int i = item_dist_weighted(rng);
-
-        // 检查(u,t)处的可用产能
-        auto key = std::make_pair(u, t);
-        double avail_cap = available_capacity[key] - used_capacity[key];
-
-        if (avail_cap <= 0) {
-            // 此(u,t)处无剩余产能，尝试其他位置
-            // 回退：找任何有可用产能的(u,t)
-            bool found = false;
-            for (const auto& entry : available_capacity) {
-                if (entry.second - used_capacity[entry.first] > 0) {
-                    u = entry.first.first;
-                    t = entry.first.second;
-                    key = entry.first;
-                    avail_cap = entry.second - used_capacity[key];
-                    found = true;
-                    break;
-                }
+/**
+ * @brief 把需求点数分配到各(u,t)
+ *
+ * @details
+ * 条件二项分布逐单元抽取多项分布：第 c 个单元得到
+ * Binomial(剩余点数, w_c / 剩余权重)，最后一个单元得到全部剩余点数。
+ * 超出空位的部分截断后留到下一轮，下一轮只在仍有空位的单元间分配；
+ * 每轮至少填满一个单元，因此必然结束，总点数恰好为 point_count。
+ */
+void DemandGenerator::AllocateCellPoints(
+    const DemandGenConfig& config,
+    const CapacityGrid& available_capacity,
+    const std::vector<double>& period_weights,
+    const std::vector<double>& node_weights,
+    const std::vector<int>& slots,
+    int point_count,
+    std::vector<int>& cell_points,
+    DemandGenStats& stats
+) {
+    CounterRng rng = StreamRng(config, DemandStream::CellCounts);
+    const size_t cell_count = slots.size();
+    const size_t T = static_cast<size_t>(available_capacity.T);
+    auto weight = [&](size_t c) { return node_weights[c / T] * period_weights[c % T]; };
+
+    cell_points.assign(cell_count, 0);
+    int remaining = point_count;
+    while (remaining > 0) {
+        ++stats.allocation_passes;
+
+        // 本轮参与分配的单元：仍有空位者
+        double open_weight = 0.0;
+        size_t last_open = 0;
+        for (size_t c = 0; c < cell_count; ++c) {
+            if (cell_points[c] < slots[c]) {
+                open_weight += weight(c);
+                last_open = c;
             }
+        }
+
+        for (size_t c = 0; c <= last_open && remaining > 0; ++c) {
+            int free_slots = slots[c] - cell_points[c];
+            if (free_slots <= 0) continue;
 
-            if (!found) {
-                // 所有位置都无剩余产能，跳过此需求
-                continue;
+            double w = weight(c);
+            int draw = remaining;
+            if (c != last_open) {
+                double p = std::clamp(w / open_weight, 0.0, 1.0);
+                draw = std::binomial_distribution<int>(remaining, p)(rng);
             }
+            open_weight -= w;
+
+            int placed = std::min(draw, free_slots);
+            stats.allocation_clamped += static_cast<uint64_t>(draw - placed);
+            cell_points[c] += placed;
+            remaining -= placed;
         }
+    }
+}
 
-        // 在可用产能范围内生成需求量
-        double max_possible_amount = avail_cap / config.unit_sX;
-        double demand_amount = std::min(amount_dist(rng), max_possible_amount);
+/**
+ * @brief 把需求总量分配到各(u,t)
+ *
+ * @details
+ * 注水：份额 = λ × w_c，超出产能 cap_c 的单元截断为 cap_c，λ 升高到其余单元的份额之和补足总量。
+ * 按 cap_c / w_c 升序处理，截断的单元恰好是前缀：当前单元按剩余总量分到的份额不超出产能时，
+ * 其后各单元的 cap/w 更大，也都不会超出。
+ */
+void DemandGenerator::AllocateCellVolumes(
+    const DemandGenConfig& config,
+    const CapacityGrid& available_capacity,
+    const std::vector<double>& period_weights,
+    const std::vector<double>& node_weights,
+    const std::vector<int>& cell_points,
+    double total_volume,
+    std::vector<double>& cell_volumes
+) {
+    const size_t cell_count = cell_points.size();
+    const size_t T = static_cast<size_t>(available_capacity.T);
+    auto weight = [&](size_t c) { return node_weights[c / T] * period_weights[c % T]; };
+    auto cap = [&](size_t c) { return available_capacity.cells[c] / config.unit_sX; };
+
+    cell_volumes.assign(cell_count, 0.0);
+
+    // 只有分到需求点的单元能承载需求量
+    std::vector<size_t> open;
+    double open_weight = 0.0;
+    for (size_t c = 0; c < cell_count; ++c) {
+        if (cell_points[c] > 0) {
+            open.push_back(c);
+            open_weight += weight(c);
+        }
+    }
+    std::sort(open.begin(), open.end(), [&](size_t a, size_t b) {
+        return cap(a) * weight(b) < cap(b) * weight(a);
+    });
+
+    double remaining = total_volume;
+    size_t k = 0;
+    for (; k < open.size(); ++k) {
+        size_t c = open[k];
+        if (remaining * weight(c) < cap(c) * open_weight) break;
+        cell_volumes[c] = cap(c);
+        remaining -= cap(c);
+        open_weight -= weight(c);
+    }
+    for (; k < open.size(); ++k) {
+        cell_volumes[open[k]] = remaining * weight(open[k]) / open_weight;
+    }
+}
 
-        // 确保最小需求量
-        demand_amount = std::max(1.0, demand_amount);
+/**
+ * @brief 生成单个(u,t)单元的需求点
+ */
+void DemandGenerator::GenerateCellDemands(
+    const DemandGenConfig& config,
+    const AliasSampler& item_dist,
+    double volume,
+    double budget,
+    int u,
+    int t,
+    int points,
+    DemandEntry* out,
+    DemandGenStats& stats
+) {
+    // 无放回地选出 points 个互不相同的物品：
+    // 按物品权重抽样，已选物品被拒绝后重抽；多次失败后从抽到的物品起顺序探测第一个未选物品
+    // （points ≤ N，探测必然成功）
+    CounterRng item_rng = StreamRng(config, DemandStream::CellItems, u, t);
+    CellKeySet chosen(static_cast<size_t>(points));
+    for (int k = 0; k < points; ++k) {
+        int i = 0;
+        bool placed = false;
+        for (int attempt = 0; attempt < kMaxSampleAttempts && !placed; ++attempt) {
+            i = item_dist(item_rng);
+            placed = chosen.insert(static_cast<uint64_t>(i));
+            if (!placed) ++stats.item_rejections;
+        }
+        if (!placed) ++stats.probe_fallbacks;
+        while (!placed) {
+            i = (i + 1 == config.N) ? 0 : i + 1;
+            placed = chosen.insert(static_cast<uint64_t>(i));
+            ++stats.probe_steps;
+        }
+        out[k] = {u, i, t, 0.0};
+    }
+
+    // 需求量在该单元分到的需求总量的平均值附近按方差均匀抽取
+    // 波动幅度不超过该单元的剩余产能，份额接近产能的单元因此不会因压缩而系统性偏少
+    double avg_demand = volume / points;
+    double spread = std::min(avg_demand * config.demand_size_variance,
+                             std::max(0.0, (budget - volume) / points));
+    double min_demand = std::max(1.0, avg_demand - spread);
+    double max_demand = std::max(min_demand, avg_demand + spread);
 
-        // 更新已使用产能
-        used_capacity[key] += demand_amount * config.unit_sX;
+    CounterRng amount_rng = StreamRng(config, DemandStream::CellAmounts, u, t);
+    std::uniform_real_distribution<double> amount_dist(min_demand, max_demand);
+    double total = 0.0;
+    for (int k = 0; k < points; ++k) {
+        out[k].amount = amount_dist(amount_rng);
+        total += out[k].amount;
+    }
 
-        // 创建需求条目
-        demands.push_back({u, i, t, demand_amount});
+    // 总量超出产能时按比例压缩超出1的部分
+    // 压缩后每点仍至少为1，且总量恰好等于产能（points ≤ budget）
+    if (total > budget) {
+        ++stats.scaled_cells;
+        stats.scaled_points += static_cast<uint64_t>(points);
+        double scale = (budget - points) / (total - points);
+        for (int k = 0; k < points; ++k) {
+            out[k].amount = 1.0 + (out[k].amount - 1.0) * scale;
+        }
     }
 }
 
@@ -315,31 +627,53 @@ void DemandGenerator::GenerateDemandPoints(
 void DemandGenerator::VerifyFeasibility(
     const DemandGenConfig& config,
     const std::vector<DemandEntry>& demands,
-    const std::map<std::pair<int,int>, double>& available_capacity
+    const CapacityGrid& available_capacity
 ) {
     // 计算每个(u,t)的实际产能使用量
-    std::map<std::pair<int,int>, double> actual_usage;
+    std::vector<double> actual_usage(available_capacity.cells.size(), 0.0);
 
     for (const auto& demand : demands) {
-        auto key = std::make_pair(demand.u, demand.t);
-        actual_usage[key] += demand.amount * config.unit_sX;
+        actual_usage[available_capacity.index(demand.u, demand.t)] += demand.amount * config.unit_sX;
     }
 
     // 检查每个(u,t)
-    for (const auto& entry : actual_usage) {
-        auto key = entry.first;
-        double usage = entry.second;
-        double capacity = available_capacity.at(key);
-
-        if (usage > capacity * 1.01) {  // 允许1%容差
-            // 这永远不应该发生！
-            throw std::runtime_error(
-                "可行性检查失败，节点 " +
-                std::to_string(key.first) + " 时段 " +
-                std::to_string(key.second) + "：使用量=" +
-                std::to_string(usage) + " > 产能=" +
-                std::to_string(capacity)
-            );
+    for (int u = 0; u < available_capacity.U; ++u) {
+        for (int t = 0; t < available_capacity.T; ++t) {
+            size_t cell = available_capacity.index(u, t);
+            double usage = actual_usage[cell];
+            double capacity = available_capacity.cells[cell];
+
+            if (usage > capacity * 1.01) {  // 允许1%容差
+                // 这永远不应该发生！
+                throw std::runtime_error(
+                    "可行性检查失败，节点 " +
+                    std::to_string(u) + " 时段 " +
+                    std::to_string(t) + "：使用量=" +
+                    std::to_string(usage) + " > 产能=" +
+                    std::to_string(capacity)
+                );
+            }
         }
     }
+
+    // 检查总利用率：需求总量应跟随目标产能利用率
+    // 有需求点的单元产能之和不足目标时，目标为这些单元的全部产能；需求点太少时随机波动过大，不检查
+    if (demands.size() < kMinPointsForUtilizationCheck) return;
+    double total_usage = 0.0;
+    double total_capacity = 0.0;
+    double populated_capacity = 0.0;
+    for (size_t cell = 0; cell < actual_usage.size(); ++cell) {
+        total_usage += actual_usage[cell];
+        total_capacity += available_capacity.cells[cell];
+        if (actual_usage[cell] > 0.0) populated_capacity += available_capacity.cells[cell];
+    }
+    double target_usage = std::min(total_capacity * config.capacity_utilization, populated_capacity);
+    if (std::abs(total_usage - target_usage) > target_usage * kUtilizationTolerance) {
+        throw std::runtime_error(
+            "产能利用率检查失败：需求占用产能=" + std::to_string(total_usage) +
+            "，目标=" + std::to_string(target_usage) +
+            "（capacity_utilization=" + std::to_string(config.capacity_utilization) +
+            "，偏差超过 " + std::to_string(kUtilizationTolerance * 100) + "%）"
+        );
+    }
 }
@@ -25,9 +25,12 @@
 #pragma once
 
 #include "case_generator.h"
-#include <random>
+#include "counter_rng.h"
+#include <cstdint>
+#include <string>
 #include <vector>
-#include <map>
+
+class AliasSampler;
 
 // ====================================================================================
 // 配置结构体
@@ -84,6 +87,135 @@ struct DemandGenConfig {
 
     double demand_size_variance = 0.3;  ///< 需求量大小的方差 (0.0-1.0)
                                        ///< 控制需求量的离散程度
+
+    //--------------------------------------------------------------------------------
+    // 并行控制
+    //--------------------------------------------------------------------------------
+    unsigned threads = 1;              ///< 需求生成线程数（1 = 顺序，0 = 全部硬件线程）
+                                       ///< 结果与线程数无关
+};
+
+// ====================================================================================
+// 产能网格
+// ====================================================================================
+
+/**
+ * @struct CapacityGrid
+ * @brief  按(节点, 时段)索引的稠密产能表
+ *
+ * @details
+ * 以连续数组存储 U×T 个单元，cells[u*T + t] 对应(u,t)。
+ * 单元按 u 为主序、t 为次序排列，遍历顺序与按(u,t)字典序一致。
+ * 需求生成的热循环只做数组下标访问，不再查找红黑树。
+ */
+struct CapacityGrid {
+    int U = 0;                  ///< 节点数量
+    int T = 0;                  ///< 时间周期数量
+    std::vector<double> cells;  ///< U×T 个单元的值
+
+    /**
+     * @brief 重置网格尺寸并将所有单元设为同一值
+     */
+    void assign(int u_count, int t_count, double value) {
+        U = u_count;
+        T = t_count;
+        cells.assign(static_cast<size_t>(u_count) * t_count, value);
+    }
+
+    /**
+     * @brief (u,t) 对应的一维下标
+     */
+    size_t index(int u, int t) const { return static_cast<size_t>(u) * T + t; }
+
+    double& at(int u, int t) { return cells[index(u, t)]; }
+    double at(int u, int t) const { return cells[index(u, t)]; }
+};
+
+// ====================================================================================
+// 生成统计
+// ====================================================================================
+
+/**
+ * @struct DemandGenStats
+ * @brief  一次需求生成中各退化路径的命中次数
+ *
+ * @details
+ * 热循环里只对任务栈上的局部副本做整数自增，任务结束时写回一次，任务之间不共享缓存行；
+ * 全部任务完成后按任务顺序合并，因此统计值与线程数无关，也不需要原子操作。
+ */
+struct DemandGenStats {
+    uint64_t requested_points = 0;    ///< 按需求密度计算的目标点数
+    uint64_t generated_points = 0;    ///< 实际生成的点数
+    uint64_t dropped_points = 0;      ///< 产能空位不足而未生成的点数
+
+    uint64_t allocation_passes = 0;   ///< 点数分配的轮数（1 = 一轮分完）
+    uint64_t allocation_clamped = 0;  ///< 分配时超出单元空位、被截断留到下一轮的点数
+
+    uint64_t item_rejections = 0;     ///< 抽到已选物品而重抽的次数
+    uint64_t probe_fallbacks = 0;     ///< 重抽 kMaxSampleAttempts 次仍失败、改为顺序探测的点数
+    uint64_t probe_steps = 0;         ///< 顺序探测经过的物品数
+
+    uint64_t scaled_cells = 0;        ///< 需求量总和超出产能、按比例压缩的单元数
+    uint64_t scaled_points = 0;       ///< 被压缩的需求点数
+
+    /**
+     * @brief 累加另一份统计
+     */
+    void merge(const DemandGenStats& other) {
+        requested_points += other.requested_points;
+        generated_points += other.generated_points;
+        dropped_points += other.dropped_points;
+        allocation_passes += other.allocation_passes;
+        allocation_clamped += other.allocation_clamped;
+        item_rejections += other.item_rejections;
+        probe_fallbacks += other.probe_fallbacks;
+        probe_steps += other.probe_steps;
+        scaled_cells += other.scaled_cells;
+        scaled_points += other.scaled_points;
+    }
+
+    /**
+     * @brief 是否命中过任一退化路径（丢点、截断、顺序探测、压缩）
+     */
+    bool degenerate() const {
+        return dropped_points > 0 || allocation_clamped > 0 || probe_fallbacks > 0 || scaled_cells > 0;
+    }
+
+    /**
+     * @brief 单行文本，用于日志
+     */
+    std::string toString() const {
+        return "目标点数=" + std::to_string(requested_points) +
+               " 生成=" + std::to_string(generated_points) +
+               " 丢弃=" + std::to_string(dropped_points) +
+               " 分配轮数=" + std::to_string(allocation_passes) +
+               " 截断=" + std::to_string(allocation_clamped) +
+               " 重抽=" + std::to_string(item_rejections) +
+               " 探测=" + std::to_string(probe_fallbacks) + "/" + std::to_string(probe_steps) +
+               " 压缩=" + std::to_string(scaled_cells) + "单元/" + std::to_string(scaled_points) + "点";
+    }
+};
+
+// ====================================================================================
+// 随机数流
+// ====================================================================================
+
+/**
+ * @enum  DemandStream
+ * @brief 需求生成使用的随机数流编号（CounterRng 计数器的 stream 字段）
+ *
+ * @details
+ * 权重和点数分配是全局流（u = t = kNoIndex）；
+ * 物品选择和需求量按(u,t)各用一条流，任一单元的结果与其他单元的抽取次数无关。
+ * 修改编号会改变所有生成结果。
+ */
+enum class DemandStream : uint32_t {
+    PeriodWeights = 1,  ///< 时段权重
+    NodeWeights   = 2,  ///< 节点权重
+    ItemWeights   = 3,  ///< 物品权重
+    CellCounts    = 4,  ///< 各(u,t)的需求点数分配
+    CellItems     = 5,  ///< (u,t)内的物品选择
+    CellAmounts   = 6,  ///< (u,t)内的需求量
 };
 
 // ====================================================================================
@@ -99,8 +231,8 @@ struct DemandGenConfig {
  * 1. 计算每个(节点, 时段)的可用产能
  * 2. 根据需求密度估算启动开销
  * 3. 计算生产产能 = 总产能 - 启动开销
- * 4. 将生产产能分配给需求点
- * 5. 生成与产能分配精确匹配的需求量
+ * 4. 按 目标利用率 × 生产产能 确定需求总量，按权重分配给各(u,t)，单元份额不超过其生产产能
+ * 5. 在各单元的份额附近生成需求量，超出产能时压缩
  *
  * 可行性保证：
  * 通过构造确保：sum(需求 * sX + 启动 * sY) <= C[u][t] 对所有u,t成立
@@ -114,7 +246,7 @@ public:
      * @return vector<DemandEntry> 生成的需求列表（保证可行）
      *
      * @details
-     * 步骤1：初始化随机数生成器
+     * 步骤1：按 (seed, u, t, stream) 划分随机数流
      * 步骤2：计算目标需求点数量
      * 步骤3：跨时段分配产能
      * 步骤4：使用分配的产能生成需求点
@@ -122,6 +254,27 @@ public:
      */
     static std::vector<DemandEntry> Generate(const DemandGenConfig& config);
 
+    /**
+     * @brief 使用产能驱动方法生成需求（写入已有容器）
+     *
+     * @param config  配置参数
+     * @param demands 输出的需求列表（原有内容会被清空，但保留已分配的容量）
+     *
+     * @details
+     * 批量生成时重复使用同一个容器，避免每个算例重新分配内存。
+     */
+    static void Generate(const DemandGenConfig& config, std::vector<DemandEntry>& demands);
+
+    /**
+     * @brief 使用产能驱动方法生成需求，并返回退化路径统计
+     *
+     * @param config  配置参数
+     * @param demands 输出的需求列表（原有内容会被清空，但保留已分配的容量）
+     * @param stats   输出的生成统计（原有内容会被覆盖）
+     */
+    static void Generate(const DemandGenConfig& config, std::vector<DemandEntry>& demands,
+                         DemandGenStats& stats);
+
 private:
     //--------------------------------------------------------------------------------
     // 产能计算
@@ -131,15 +284,16 @@ private:
      * @brief 计算每个(节点, 时段)的可用生产产能
      *
      * @param config 配置参数
-     * @param available_capacity 输出映射: (u,t) -> 可用产能
+     * @param available_capacity 输出网格: (u,t) -> 可用产能
      *
      * @details
      * 可用产能 = 总产能 - 启动开销
-     * 启动开销根据需求密度和物品数量估算
+     * 启动开销根据需求密度和物品数量估算。
+     * 这里不乘 capacity_utilization：利用率决定需求总量，单元上限是完整的生产产能。
      */
     static void CalculateAvailableCapacity(
         const DemandGenConfig& config,
-        std::map<std::pair<int,int>, double>& available_capacity
+        CapacityGrid& available_capacity
     );
 
     //--------------------------------------------------------------------------------
@@ -159,7 +313,7 @@ private:
      */
     static void GeneratePeriodWeights(
         const DemandGenConfig& config,
-        std::mt19937& rng,
+        CounterRng& rng,
         std::vector<double>& weights
     );
 
@@ -172,7 +326,20 @@ private:
      */
     static void GenerateNodeWeights(
         const DemandGenConfig& config,
-        std::mt19937& rng,
+        CounterRng& rng,
+        std::vector<double>& weights
+    );
+
+    /**
+     * @brief 根据物品集中度生成物品权重
+     *
+     * @param config 配置参数
+     * @param rng 随机数生成器
+     * @param weights 输出的物品权重向量（大小为N）
+     */
+    static void GenerateItemWeights(
+        const DemandGenConfig& config,
+        CounterRng& rng,
         std::vector<double>& weights
     );
 
@@ -184,31 +351,118 @@ private:
      * @brief 使用产能分配生成需求点
      *
      * @param config 配置参数
-     * @param rng 随机数生成器
-     * @param available_capacity 可用产能映射
+     * @param available_capacity 可用产能网格
      * @param period_weights 时段权重
      * @param node_weights 节点权重
      * @param total_demand_points 需生成的总需求点数
      * @param demands 输出的需求列表
+     * @param stats 生成统计（累加）
      *
      * @details
      * 算法步骤：
-     * 1. 计算所有(u,t)的总可用产能
-     * 2. 计算平均需求大小 = 总产能 / 需求数量
-     * 3. 对于每个需求点：
-     *    a. 按照产能比例选择(u,t)
-     *    b. 随机选择物品i（考虑集中度）
-     *    c. 从产能预算中生成需求量
-     *    d. 更新剩余产能
+     * 1. 计算需求总量 = capacity_utilization × 所有(u,t)的生产产能之和 / sX
+     * 2. 按 节点×时段 权重把 k 个需求点分配到各(u,t)（AllocateCellPoints，O(U×T)）
+     * 3. 按同一权重把需求总量分配到有需求点的(u,t)，超出单元产能的份额注水到其余单元
+     *    （AllocateCellVolumes），热门单元最多用满产能，实际利用率跟随 capacity_utilization
+     * 4. 各(u,t)独立选出互不相同的物品，在该单元平均份额附近生成需求量（GenerateCellDemands），
+     *    按点数前缀和直接写入输出中该单元的位置（u 为主序、t 为次序）
+     *
+     * config.threads != 1 且需求点足够多时，U×T 网格按点数均分为约 4×threads 个连续区间，
+     * 在 WorkStealingPool 上并行生成第4步。各单元只使用自己的随机数流并写入互不重叠的位置，
+     * 输出与顺序生成逐位一致。
+     *
+     * 每个(u,t)最多容纳 min(N, floor(产能/sX)) 个需求点（物品互不相同、每点至少1单位）。
+     * 输出恰好 k = min(total_demand_points, 所有(u,t)空位之和) 个需求点，且没有重复的(u,i,t)；
+     * 只有产能连这么多点都容纳不下时才会少于 total_demand_points。
      */
     static void GenerateDemandPoints(
         const DemandGenConfig& config,
-        std::mt19937& rng,
-        std::map<std::pair<int,int>, double>& available_capacity,
+        const CapacityGrid& available_capacity,
         const std::vector<double>& period_weights,
         const std::vector<double>& node_weights,
         int total_demand_points,
-        std::vector<DemandEntry>& demands
+        std::vector<DemandEntry>& demands,
+        DemandGenStats& stats
+    );
+
+    /**
+     * @brief 按 节点×时段 权重把需求点数分配到各(u,t)
+     *
+     * @param config 配置参数
+     * @param available_capacity 可用产能网格（提供 T）
+     * @param period_weights 时段权重
+     * @param node_weights 节点权重
+     * @param slots 各(u,t)最多容纳的需求点数
+     * @param point_count 需分配的总点数（不超过 slots 之和）
+     * @param cell_points 输出：各(u,t)的需求点数，总和恰好为 point_count
+     * @param stats 生成统计（累加）
+     */
+    static void AllocateCellPoints(
+        const DemandGenConfig& config,
+        const CapacityGrid& available_capacity,
+        const std::vector<double>& period_weights,
+        const std::vector<double>& node_weights,
+        const std::vector<int>& slots,
+        int point_count,
+        std::vector<int>& cell_points,
+        DemandGenStats& stats
+    );
+
+    /**
+     * @brief 按 节点×时段 权重把需求总量分配到各(u,t)
+     *
+     * @param config 配置参数
+     * @param available_capacity 生产产能网格
+     * @param period_weights 时段权重
+     * @param node_weights 节点权重
+     * @param cell_points 各(u,t)的需求点数
+     * @param total_volume 需求总量（需求量单位）
+     * @param cell_volumes 输出：各(u,t)分到的需求量（没有需求点的单元为0）
+     *
+     * @details
+     * 有需求点的单元按权重比例分配，份额不超过该单元的产能 / sX；
+     * 截断的部分按权重注水到仍有余量的单元。所有单元都用满时总和小于 total_volume。
+     */
+    static void AllocateCellVolumes(
+        const DemandGenConfig& config,
+        const CapacityGrid& available_capacity,
+        const std::vector<double>& period_weights,
+        const std::vector<double>& node_weights,
+        const std::vector<int>& cell_points,
+        double total_volume,
+        std::vector<double>& cell_volumes
+    );
+
+    /**
+     * @brief 生成单个(u,t)单元的需求点，追加到 demands
+     *
+     * @param config 配置参数
+     * @param item_dist 物品别名表采样器
+     * @param volume 该单元分到的需求量（AllocateCellVolumes）
+     * @param budget 该单元可容纳的需求总量（生产产能 / sX，不小于 points）
+     * @param u 节点索引
+     * @param t 时段索引
+     * @param points 需求点数（不超过 N）
+     * @param out 输出位置（points 个元素）
+     * @param stats 生成统计（累加）
+     *
+     * @details
+     * 物品按权重无放回抽取：已选物品被拒绝后重抽，kMaxSampleAttempts 次后顺序探测。
+     * 需求量在 volume / points 附近按 demand_size_variance 均匀抽取，每点至少为1；
+     * 波动幅度不超过 (budget - volume) / points，用满产能的单元各点需求量相同；
+     * 总和超出 budget 时按比例压缩超出1的部分。
+     * 只使用该单元自己的随机数流，结果与其他单元无关，可在任意线程上调用。
+     */
+    static void GenerateCellDemands(
+        const DemandGenConfig& config,
+        const AliasSampler& item_dist,
+        double volume,
+        double budget,
+        int u,
+        int t,
+        int points,
+        DemandEntry* out,
+        DemandGenStats& stats
     );
 
     //--------------------------------------------------------------------------------
@@ -220,15 +474,17 @@ private:
      *
      * @param config 配置参数
      * @param demands 生成的需求列表
-     * @param available_capacity 可用产能映射
+     * @param available_capacity 可用产能网格
      *
      * @details
      * 这是一个健全性检查。设计上需求应该总是可行的。
+     * 需求点不少于1000个时，还检查需求占用的总产能与
+     * capacity_utilization × 总生产产能（有需求点的单元产能之和更小时取后者）相差不超过3%。
      * 如果此检查失败，说明生成逻辑存在bug。
      */
     static void VerifyFeasibility(
         const DemandGenConfig& config,
         const std::vector<DemandEntry>& demands,
-        const std::map<std::pair<int,int>, double>& available_capacity
+        const CapacityGrid& available_capacity
     );
 };
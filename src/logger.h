@@ -2,7 +2,7 @@
  * ==================================================================================
  * @file        logger.h
  * @brief       日志记录器 - 头文件和实现
- * @version     1.0.0
+ * @version     1.2.0
  * @date        2025-10-13
  *
  * @description
@@ -10,32 +10,45 @@
  *
  * 主要功能：
  * - 实时输出日志到控制台（带时间戳）
- * - 缓存所有日志到内存
- * - 支持将日志保存到文件
+ * - 构造时打开日志文件，每条（异步模式为每批）日志立即追加写入，内存占用与运行时长无关
+ * - 日志文件超过 max_file_bytes 时轮转：log_X.txt -> log_X.1.txt -> log_X.2.txt ...，
+ *   最多保留 keep_files 个旧文件
  * - 自动生成带时间戳的日志文件名
- * - 线程安全（使用互斥锁保护）
+ * - 线程安全（同步模式使用互斥锁，异步模式使用无锁环形队列）
+ *
+ * 两种模式：
+ * - Mode::Sync（默认）：log() 在调用线程上加锁写控制台，每行刷新一次
+ * - Mode::Async：log() 只格式化一行并放入无锁 MPSC 环形队列，
+ *   后台线程成批取出，一次写控制台、一次写文件；
+ *   多个工作线程同时记录日志时不再在控制台I/O上串行
  *
  * 日志格式：
  *   [YYYY-MM-DD HH:MM:SS] 日志消息内容
+ *   [YYYY-MM-DD HH:MM:SS] [t1] 工作线程的日志消息内容
+ *
+ * 创建 Logger 的线程不带标签；其他线程第一次记录日志时自动分配 t1、t2... 标签，
+ * 也可以用 setThreadTag() 指定。
  *
  * 文件名格式：
- *   output/logs/log_YYYYMMDD_HHMMSS.txt
+ *   output/logs/log_YYYYMMDD_HHMMSS.txt       当前文件
+ *   output/logs/log_YYYYMMDD_HHMMSS.<k>.txt   轮转出的旧文件（k 越大越旧）
  *
  * 使用示例：
  * @code
- * Logger logger;
+ * Logger logger(Logger::Mode::Async);
  * logger.log("程序启动");
  * logger.log("配置: U=5, N=10, T=20");
  * logger.log("生成完成");
- * logger.saveToFile();  // 保存到文件
+ * logger.saveToFile();  // 等待队列写完并刷新文件
  * @endcode
  *
  * 线程安全性：
- * - 所有公共方法都使用互斥锁保护
- * - 可以在多线程环境中安全使用
+ * - 所有公共方法都可以在多线程环境中安全调用
+ * - 异步模式下同一线程的日志保持顺序，不同线程之间按入队顺序
  *
  * @note 本类采用header-only设计，所有实现都在头文件中
- * @note 日志文件名在构造时生成，确保每次运行有唯一的日志文件
+ * @note 日志文件在构造时生成并打开，确保每次运行有唯一的日志文件；进程崩溃时已写出的日志不会丢失
+ * @note 异步模式的析构函数会写完队列中剩余的日志
  *
  * @author      LS-Game-DataGen Team
  * ==================================================================================
@@ -46,9 +59,16 @@
 #include <sstream>
 #include <fstream>
 #include <iostream>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <filesystem>
 #include <iomanip>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include "output_paths.h"
 
 /**
  * @class Logger
@@ -57,20 +77,111 @@
  * @details
  * 提供简单易用的日志记录功能：
  * - 实时控制台输出（方便查看进度）
- * - 内存缓存（便于最后一次性保存）
- * - 文件持久化（便于事后分析）
+ * - 流式文件持久化（按大小轮转，便于事后分析）
  * - 线程安全（支持多线程场景）
  *
  * 设计特点：
  * - Header-only：所有实现都在头文件中，无需单独的.cpp文件
- * - RAII风格：构造时初始化，析构时自动清理
- * - 懒保存：只在显式调用saveToFile()时写入文件
+ * - RAII风格：构造时打开文件，析构时写完剩余日志并关闭
  */
 class Logger {
+public:
+    /**
+     * @brief 日志模式
+     */
+    enum class Mode {
+        Sync,   ///< 调用线程直接写控制台
+        Async,  ///< 入队后由后台线程成批写出
+    };
+
 private:
-    std::ostringstream buffer;  ///< 日志缓冲区，存储所有日志消息
+    /**
+     * @class LogRing
+     * @brief 有界多生产者单消费者无锁环形队列（Vyukov 算法）
+     *
+     * @details
+     * 每个槽位带一个序号：序号等于入队位置时可写，等于位置+1时可读。
+     * 生产者只在入队位置上做一次 CAS，不加锁；唯一的消费者是后台刷新线程。
+     */
+    class LogRing {
+    public:
+        explicit LogRing(size_t capacity) : slots_(new Slot[capacity]), mask_(capacity - 1) {
+            for (size_t k = 0; k < capacity; ++k) {
+                slots_[k].seq.store(k, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief 入队（任意线程）
+         *
+         * @return bool 队列已满时返回 false，line 保持不变
+         */
+        bool tryPush(std::string& line) {
+            size_t pos = tail_.load(std::memory_order_relaxed);
+            while (true) {
+                Slot& slot = slots_[pos & mask_];
+                size_t seq = slot.seq.load(std::memory_order_acquire);
+                if (seq == pos) {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        slot.line = std::move(line);
+                        slot.seq.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (seq < pos) {
+                    return false;  // 消费者尚未取走一整圈之前的记录
+                } else {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief 出队（仅后台线程）
+         *
+         * @return bool 队列为空时返回 false
+         */
+        bool tryPop(std::string& line) {
+            Slot& slot = slots_[head_ & mask_];
+            if (slot.seq.load(std::memory_order_acquire) != head_ + 1) return false;
+            line = std::move(slot.line);
+            slot.line.clear();
+            slot.seq.store(head_ + mask_ + 1, std::memory_order_release);
+            ++head_;
+            return true;
+        }
+
+    private:
+        struct Slot {
+            std::atomic<size_t> seq{0};  ///< 槽位序号
+            std::string line;            ///< 已格式化的日志行
+        };
+
+        std::unique_ptr<Slot[]> slots_;  ///< 槽位数组（容量为2的幂）
+        size_t mask_;                    ///< 容量 - 1
+        alignas(64) std::atomic<size_t> tail_{0};  ///< 下一个入队位置（生产者共享）
+        alignas(64) size_t head_ = 0;              ///< 下一个出队位置（仅消费者）
+    };
+
+    /// 异步队列容量（条）；队列满时生产者让出CPU等待后台线程取走
+    static constexpr size_t kRingCapacity = 4096;
+
     std::string log_filename;   ///< 日志文件名（在构造时生成）
-    std::mutex mutex;           ///< 互斥锁，保护buffer和log_filename的并发访问
+    std::ofstream file_;        ///< 当前日志文件（打开失败时只输出到控制台）
+    size_t file_bytes_ = 0;     ///< 当前日志文件已写字节数
+    size_t max_file_bytes_;     ///< 单个日志文件的字节上限（0 表示不轮转）
+    int keep_files_;            ///< 轮转时保留的旧文件数
+    std::mutex mutex;           ///< 互斥锁，保护控制台输出和文件写入
+
+    Mode mode_;                            ///< 日志模式
+    std::thread::id owner_thread_;         ///< 创建 Logger 的线程（日志行不带标签）
+    std::unique_ptr<LogRing> ring_;        ///< 异步队列（仅异步模式）
+    std::thread flusher_;                  ///< 后台刷新线程（仅异步模式）
+    std::atomic<bool> stop_{false};        ///< 停止后台线程
+    std::atomic<size_t> pushed_{0};        ///< 已入队的记录数
+    std::atomic<size_t> written_{0};       ///< 已写出的记录数
+    std::mutex wake_mutex_;                ///< 配合条件变量等待
+    std::condition_variable wake_cv_;      ///< 唤醒后台线程
+    std::condition_variable written_cv_;   ///< 通知 flush() 写出进度
 
     /**
      * @brief 获取当前时间戳字符串（用于日志消息）
@@ -86,29 +197,161 @@ private:
      *
      * 示例输出：[2025-10-13 17:30:45]
      *
-     * @note 使用 localtime_s（Windows）而非 localtime（线程安全）
+     * 每个线程缓存上一次格式化的秒，同一秒内的日志直接复用，不重复转换本地时间。
+     *
+     * @note 使用 OutputPaths::LocalTime（线程安全）而非 localtime
      */
     static std::string getCurrentTimestamp() {
-        // 获取当前系统时间
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
-
-        // 转换为本地时间（线程安全版本）
-        std::tm tm_now;
-        localtime_s(&tm_now, &time_t_now);
-
-        // 格式化时间戳
-        std::ostringstream oss;
-        oss << "["
-            << std::setfill('0')
-            << std::setw(4) << (tm_now.tm_year + 1900) << "-"  // 年份（加1900）
-            << std::setw(2) << (tm_now.tm_mon + 1) << "-"      // 月份（加1）
-            << std::setw(2) << tm_now.tm_mday << " "           // 日期
-            << std::setw(2) << tm_now.tm_hour << ":"           // 小时
-            << std::setw(2) << tm_now.tm_min << ":"            // 分钟
-            << std::setw(2) << tm_now.tm_sec                   // 秒
-            << "]";
-        return oss.str();
+        thread_local std::time_t cached_second = -1;
+        thread_local char cached[32] = "";
+
+        std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        if (now != cached_second) {
+            std::tm tm_now = OutputPaths::LocalTime(now);
+            std::strftime(cached, sizeof(cached), "[%Y-%m-%d %H:%M:%S]", &tm_now);
+            cached_second = now;
+        }
+        return cached;
+    }
+
+    /**
+     * @brief 当前线程的日志标签（可写引用）
+     */
+    static std::string& threadTag() {
+        thread_local std::string tag;
+        return tag;
+    }
+
+    /**
+     * @brief 当前线程是否已有标签（显式设置或自动分配）
+     */
+    static bool& threadTagAssigned() {
+        thread_local bool assigned = false;
+        return assigned;
+    }
+
+    /**
+     * @brief 格式化一行日志：[时间戳] [标签] 消息
+     */
+    std::string formatLine(const std::string& message) const {
+        if (!threadTagAssigned()) {
+            // 非创建线程第一次记录日志时自动分配 t1、t2...
+            static std::atomic<int> next_id{1};
+            threadTagAssigned() = true;
+            if (std::this_thread::get_id() != owner_thread_) {
+                threadTag() = "t" + std::to_string(next_id.fetch_add(1, std::memory_order_relaxed));
+            }
+        }
+
+        std::string line = getCurrentTimestamp();
+        line.reserve(line.size() + threadTag().size() + message.size() + 4);
+        if (!threadTag().empty()) {
+            line += " [";
+            line += threadTag();
+            line += "]";
+        }
+        line += " ";
+        line += message;
+        return line;
+    }
+
+    /**
+     * @brief 后台刷新线程主循环（仅异步模式）
+     *
+     * @details
+     * 一次取出队列中所有已就绪的记录拼成一批（最多64KB），整批写控制台和文件；
+     * 队列为空时在条件变量上最多等待 20ms（生产者入队后会唤醒）。
+     */
+    void flusherLoop() {
+        std::string batch;
+        std::string line;
+        size_t drained = 0;
+
+        while (true) {
+            while (batch.size() < (1 << 16) && ring_->tryPop(line)) {
+                batch += line;
+                batch += '\n';
+                ++drained;
+            }
+
+            if (!batch.empty()) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    std::cout.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                    std::cout.flush();
+                    writeFile(batch);
+                }
+                batch.clear();
+                {
+                    std::lock_guard<std::mutex> lock(wake_mutex_);
+                    written_.store(drained, std::memory_order_release);
+                }
+                written_cv_.notify_all();
+                continue;
+            }
+
+            if (stop_.load(std::memory_order_acquire) &&
+                written_.load(std::memory_order_relaxed) == pushed_.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_cv_.wait_for(lock, std::chrono::milliseconds(20));
+        }
+    }
+
+    /**
+     * @brief 第 k 个轮转文件名：log_X.txt -> log_X.<k>.txt
+     */
+    std::string rotatedFilename(int k) const {
+        std::string name = log_filename;
+        size_t dot = name.rfind(".txt");
+        return name.substr(0, dot) + "." + std::to_string(k) + name.substr(dot);
+    }
+
+    /**
+     * @brief 把已格式化的日志（含换行）追加到文件并刷新（调用方持有 mutex）
+     *
+     * @details
+     * 写入后会超过 max_file_bytes 时先轮转；单条超长日志也完整写入同一个文件。
+     */
+    void writeFile(const std::string& text) {
+        if (!file_.is_open()) return;
+        if (max_file_bytes_ > 0 && file_bytes_ > 0 && file_bytes_ + text.size() > max_file_bytes_) {
+            rotate();
+            if (!file_.is_open()) return;
+        }
+        file_.write(text.data(), static_cast<std::streamsize>(text.size()));
+        file_.flush();
+        file_bytes_ += text.size();
+    }
+
+    /**
+     * @brief 轮转日志文件（调用方持有 mutex）
+     *
+     * @details
+     * 删除最旧的 log_X.<keep>.txt，其余旧文件编号依次加一，
+     * 当前文件改名为 log_X.1.txt，再重新创建 log_X.txt。
+     * 改名失败时只提示，继续写入新文件。
+     */
+    void rotate() {
+        file_.close();
+        std::error_code ec;
+        if (keep_files_ > 0) {
+            std::filesystem::remove(rotatedFilename(keep_files_), ec);
+            for (int k = keep_files_ - 1; k >= 1; --k) {
+                std::filesystem::rename(rotatedFilename(k), rotatedFilename(k + 1), ec);
+            }
+            std::filesystem::rename(log_filename, rotatedFilename(1), ec);
+            if (ec) {
+                std::cerr << "[错误] 日志文件轮转失败: " << ec.message() << std::endl;
+            }
+        }
+        file_.open(log_filename, std::ios::out | std::ios::trunc | std::ios::binary);
+        file_bytes_ = 0;
+        if (!file_.is_open()) {
+            std::cerr << "[错误] 无法打开日志文件: " << log_filename << std::endl;
+        }
     }
 
     /**
@@ -130,67 +373,77 @@ private:
      * @note 在构造函数中调用，确保每个Logger实例有唯一的文件名
      */
     static std::string generateLogFilename(const std::string& output_dir) {
-        // 获取当前系统时间
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
-
-        // 转换为本地时间（线程安全版本）
-        std::tm tm_now;
-        localtime_s(&tm_now, &time_t_now);
-
-        // 构建文件名
-        std::ostringstream oss;
-        oss << output_dir << "/log_"
-            << std::setfill('0')
-            << std::setw(4) << (tm_now.tm_year + 1900)  // 年份
-            << std::setw(2) << (tm_now.tm_mon + 1)      // 月份
-            << std::setw(2) << tm_now.tm_mday           // 日期
-            << "_"
-            << std::setw(2) << tm_now.tm_hour           // 小时
-            << std::setw(2) << tm_now.tm_min            // 分钟
-            << std::setw(2) << tm_now.tm_sec            // 秒
-            << ".txt";
-        return oss.str();
+        return output_dir + "/log_" + OutputPaths::FileStamp(OutputPaths::Now()) + ".txt";
     }
 
 public:
+    /// 默认单个日志文件上限（64MB）
+    static constexpr size_t kDefaultMaxFileBytes = size_t{64} << 20;
+
+    /// 默认保留的旧日志文件数
+    static constexpr int kDefaultKeepFiles = 4;
+
     /**
-     * @brief 构造函数 - 初始化日志器并生成日志文件名
+     * @brief 构造函数 - 生成日志文件名并打开日志文件
+     *
+     * @param mode           日志模式（默认同步）
+     * @param max_file_bytes 单个日志文件的字节上限，超过后轮转（0 表示不轮转）
+     * @param keep_files     轮转时保留的旧文件数（0 表示不保留，直接清空当前文件）
      *
      * @details
-     * 在构造时生成唯一的日志文件名，但不立即创建文件。
-     * 文件会在调用 saveToFile() 时创建和写入。
+     * 在构造时生成唯一的日志文件名并立即创建文件，此后每条日志直接追加写入。
+     * 文件无法打开时只在 stderr 提示，日志仍输出到控制台。
+     * 异步模式在构造时启动后台刷新线程。
      */
-    Logger() {
+    explicit Logger(Mode mode = Mode::Sync,
+                    size_t max_file_bytes = kDefaultMaxFileBytes,
+                    int keep_files = kDefaultKeepFiles)
+        : max_file_bytes_(max_file_bytes), keep_files_(keep_files),
+          mode_(mode), owner_thread_(std::this_thread::get_id()) {
         // 获取项目根目录路径（向上查找包含CMakeLists.txt的目录）
-        std::string project_root = "";
-        std::string current_dir = ".";
-        for (int i = 0; i < 5; ++i) {  // 最多向上查找5级目录
-            std::ifstream cmake_file(current_dir + "/CMakeLists.txt");
-            if (cmake_file.good()) {
-                project_root = current_dir;
-                break;
-            }
-            current_dir = "../" + current_dir;
-        }
-        
-        // 如果没找到，使用当前目录
-        if (project_root.empty()) {
-            project_root = ".";
+        std::string logs_dir = OutputPaths::FindProjectRoot() + "/output/logs";
+
+        // 确保output和logs目录存在（失败时只提示，日志仍输出到控制台）
+        try {
+            OutputPaths::EnsureDirectory(logs_dir);
+        } catch (const std::exception& ex) {
+            std::cerr << "[错误] " << ex.what() << std::endl;
         }
-        
-        std::string output_dir = project_root + "/output";
-        std::string logs_dir = output_dir + "/logs";
-
-        // 确保output和logs目录存在
-        #ifdef _WIN32
-            system(("if not exist \"" + output_dir + "\" mkdir \"" + output_dir + "\"").c_str());
-            system(("if not exist \"" + logs_dir + "\" mkdir \"" + logs_dir + "\"").c_str());
-        #else
-            system(("mkdir -p \"" + logs_dir + "\"").c_str());
-        #endif
 
         log_filename = generateLogFilename(logs_dir);
+        file_.open(log_filename, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file_.is_open()) {
+            std::cerr << "[错误] 无法打开日志文件: " << log_filename << std::endl;
+        }
+
+        if (mode_ == Mode::Async) {
+            ring_ = std::make_unique<LogRing>(kRingCapacity);
+            flusher_ = std::thread([this] { flusherLoop(); });
+        }
+    }
+
+    /**
+     * @brief 析构函数 - 异步模式下写完队列中剩余的日志并停止后台线程
+     */
+    ~Logger() {
+        if (flusher_.joinable()) {
+            stop_.store(true, std::memory_order_release);
+            wake_cv_.notify_one();
+            flusher_.join();
+        }
+    }
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief 设置当前线程的日志标签
+     *
+     * @param tag 标签（为空表示不带标签）
+     */
+    static void setThreadTag(const std::string& tag) {
+        threadTag() = tag;
+        threadTagAssigned() = true;
     }
 
     /**
@@ -199,82 +452,90 @@ public:
      * @param message 日志消息内容
      *
      * @details
-     * 执行步骤：
-     * 1. 加锁（确保线程安全）
-     * 2. 获取当前时间戳
-     * 3. 格式化日志行：[时间戳] 消息
-     * 4. 输出到控制台（实时显示）
-     * 5. 追加到内存缓冲区（用于后续保存）
-     * 6. 解锁
+     * 同步模式执行步骤：
+     * 1. 格式化日志行：[时间戳] [标签] 消息
+     * 2. 加锁（确保线程安全）
+     * 3. 输出到控制台（实时显示）
+     * 4. 追加写入日志文件（必要时轮转）
+     * 5. 解锁
+     *
+     * 异步模式只格式化并入队，控制台和文件由后台线程成批写出；
+     * 队列满时让出CPU直到有空位。
      *
      * 日志格式：
      *   [YYYY-MM-DD HH:MM:SS] 消息内容
      *
-     * 线程安全：使用互斥锁保护，多线程调用安全
+     * 线程安全：多线程调用安全
      *
-     * @note 控制台输出后会立即flush，确保实时显示
+     * @note 同步模式控制台输出后会立即flush，确保实时显示
      */
     void log(const std::string& message) {
+        std::string line = formatLine(message);
+
+        if (mode_ == Mode::Async) {
+            while (!ring_->tryPush(line)) {
+                wake_cv_.notify_one();
+                std::this_thread::yield();
+            }
+            pushed_.fetch_add(1, std::memory_order_release);
+            wake_cv_.notify_one();
+            return;
+        }
+
         // 加锁保护共享资源
         std::lock_guard<std::mutex> lock(mutex);
 
-        // 获取时间戳
-        std::string timestamp = getCurrentTimestamp();
+        // 输出到控制台（实时显示）
+        line += '\n';
+        std::cout << line << std::flush;
 
-        // 构建完整的日志行
-        std::string line = timestamp + " " + message;
+        // 追加写入日志文件
+        writeFile(line);
+    }
 
-        // 输出到控制台（实时显示）
-        std::cout << line << std::endl;
+    /**
+     * @brief 等待此前入队的日志全部写出（同步模式下立即返回）
+     */
+    void flush() {
+        if (mode_ != Mode::Async) return;
 
-        // 追加到缓冲区（用于后续保存）
-        buffer << line << "\n";
+        size_t target = pushed_.load(std::memory_order_acquire);
+        wake_cv_.notify_one();
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        written_cv_.wait(lock, [&] {
+            return written_.load(std::memory_order_acquire) >= target;
+        });
     }
 
     /**
-     * @brief 将所有日志保存到文件
+     * @brief 确认日志已全部写入文件
      *
      * @details
-     * 执行步骤：
-     * 1. 加锁（确保线程安全）
-     * 2. 打开日志文件（覆盖模式）
-     * 3. 写入缓冲区中的所有日志
-     * 4. 关闭文件
-     * 5. 在控制台和缓冲区中记录保存成功信息
-     * 6. 如果失败，输出错误信息到stderr
-     * 7. 解锁
+     * 日志在记录时已经流式写入文件，这里只需：
+     * 1. 异步模式下等待队列写完（flush）
+     * 2. 在控制台和文件中记录一条"日志已保存"的消息
+     * 3. 日志文件无法写入时输出错误信息到stderr
      *
-     * 文件位置：由构造函数生成的 log_filename
-     * 文件编码：默认（通常为系统默认编码）
+     * 文件位置：由构造函数生成的 log_filename（轮转出的旧文件为 log_X.<k>.txt）
      *
-     * 线程安全：使用互斥锁保护，多线程调用安全
+     * 线程安全：多线程调用安全
      *
-     * @note 如果文件打开失败，会输出错误到stderr但不会抛出异常
-     * @note 调用后会在日志中追加一条"日志已保存"的消息
+     * @note 如果文件不可写，会输出错误到stderr但不会抛出异常
+     * @note 保留此接口以兼容原先"最后一次性保存"的调用方式
      */
     void saveToFile() {
+        flush();
+
         // 加锁保护共享资源
         std::lock_guard<std::mutex> lock(mutex);
 
-        // 尝试打开文件
-        std::ofstream file(log_filename);
-
-        if (file.is_open()) {
-            // 文件打开成功，写入所有日志
-            file << buffer.str();
-            file.close();
-
+        if (file_.is_open() && file_.good()) {
             // 记录保存成功的消息
-            std::string timestamp = getCurrentTimestamp();
-            std::string msg = timestamp + " 日志已保存到: " + log_filename;
-
-            // 输出到控制台
-            std::cout << msg << std::endl;
-
-            // 追加到缓冲区（记录这个操作本身）
-            buffer << msg << "\n";
+            std::string msg = formatLine("日志已保存到: " + log_filename) + "\n";
+            std::cout << msg << std::flush;
+            writeFile(msg);
         } else {
-            // 文件打开失败，输出错误
+            // 文件不可写，输出错误
             std::cerr << getCurrentTimestamp()
                       << " [错误] 无法保存日志文件: "
                       << log_filename << std::endl;
@@ -20,8 +20,23 @@
  * 2. 编译并运行程序
  * 3. 生成的算例保存到 output/cases/ 目录
  *
+ * 命令行参数（均可选）：
+ *   --batch <规格文件>     批量模式：按规格文件在一个进程内生成多个算例
+ *   --output-dir <目录>    算例输出目录（默认 output/cases）
+ *   --threads <n>          并行线程数（0-256，默认0 = 全部硬件线程，1 = 顺序）：批量模式按算例并行，
+ *                          单算例模式按(u,t)并行生成需求，转换模式并行解析
+ *   --exact-floats <keys>  以最短往返表示无损写出浮点值：all 或逗号分隔的key（如 Demand,cI,cY）；
+ *                          默认截断为整数
+ *   --format <csv|binary>  算例文件格式（默认csv；binary 为二进制列式格式 .lsgc）
+ *   --convert <算例文件>   转换模式：读取已有算例（CSV 或 .lsgc），按 --format 写到输出目录
+ *   --trace <文件>         把各算例、各阶段按线程的时间线写成 Chrome trace-event JSON
+ *                          （chrome://tracing 或 ui.perfetto.dev 打开）
+ *
  * 输出格式：
- * - 算例文件: output/cases/case_YYYYMMDD_HHMMSS.csv
+ * - 算例文件: output/cases/case_YYYYMMDD_HHMMSS.csv（二进制格式为 .lsgc）
+ * - 批量算例: output/cases/case_YYYYMMDD_HHMMSS_<序号>.csv
+ * - 批次清单: output/cases/batch_YYYYMMDD_HHMMSS.csv
+ * - 运行报告: 与每个算例文件同名的 .json（生效配置、各段行数、字节数、耗时、利用率）
  * - 日志文件: output/logs/log_YYYYMMDD_HHMMSS.txt
  *
  * @author      LS-Game-DataGen Team (v2.0)
@@ -29,27 +44,189 @@
  */
 
 #include "case_generator.h"
+#include "case_reader.h"
+#include "case_spec.h"
+#include "batch_runner.h"
+#include "csv_writer.h"
 #include "logger.h"
-#include "demand_generator.h"
+#include "mem_stats.h"
+#include "output_paths.h"
+#include "phase_timer.h"
+#include "run_report.h"
+#include "thread_pool.h"
+#include <filesystem>
 #include <iostream>
-#include <chrono>
-#include <iomanip>
-#include <sstream>
-#include <fstream>
+#include <string>
+
+/**
+ * @brief 把各阶段的耗时汇总表和峰值常驻内存写入日志
+ */
+static void LogPhaseSummary(Logger& logger) {
+    for (const std::string& line : PhaseTimers::SummaryTable()) {
+        logger.log(line);
+    }
+    if (uint64_t peak = MemStats::PeakRssBytes()) {
+        logger.log("峰值常驻内存 (VmHWM): " + std::to_string(peak / (1024 * 1024)) + " MB");
+    }
+}
+
+/**
+ * @brief 启用跟踪时写出跟踪文件
+ */
+static void SaveTrace(Logger& logger, const std::string& trace_file) {
+    if (trace_file.empty() || !PhaseTrace::Enabled()) return;
+    size_t events = PhaseTrace::Save(trace_file);
+    logger.log("跟踪文件: " + trace_file + "（" + std::to_string(events) + " 个事件）");
+}
 
 /**
  * @brief 主函数 - 程序入口点
  *
- * @return int 返回0表示成功，返回1表示出现异常
+ * @param argc 命令行参数个数
+ * @param argv 命令行参数
+ * @return int 返回0表示成功，返回1表示出现异常或有算例生成失败
  */
-int main() {
+int main(int argc, char* argv[]) {
     // 创建日志对象，用于记录程序运行过程和结果
-    Logger logger;
+    // 异步模式：批量生成时各工作线程的日志由后台线程成批写出，不在控制台I/O上串行
+    Logger logger(Logger::Mode::Async);
 
     try {
         logger.log("==================== LS-Game-DataGen v2.0 启动 ====================");
         logger.log("采用产能驱动生成策略，保证算例可行性");
 
+        //==============================================================================
+        // 命令行参数解析
+        //==============================================================================
+
+        std::string batch_file;   // 批量规格文件（为空表示单算例模式）
+        std::string convert_file; // 要转换格式的算例文件
+        std::string output_dir;   // 算例输出目录（为空表示 output/cases）
+        unsigned threads = 0;     // 并行线程数（0 表示全部硬件线程）
+        std::string exact_floats; // 无损浮点输出的key（为空表示截断为整数）
+        CaseFormat format = CaseFormat::Csv;  // 算例文件格式
+        std::string trace_file;   // 跟踪文件（为空表示不跟踪）
+
+        for (int a = 1; a < argc; ++a) {
+            std::string arg = argv[a];
+            if (arg == "--batch" && a + 1 < argc) {
+                batch_file = argv[++a];
+            } else if (arg == "--convert" && a + 1 < argc) {
+                convert_file = argv[++a];
+            } else if (arg == "--output-dir" && a + 1 < argc) {
+                output_dir = argv[++a];
+            } else if (arg == "--threads" && a + 1 < argc) {
+                threads = WorkStealingPool::ParseThreads(argv[++a]);
+            } else if (arg == "--exact-floats" && a + 1 < argc) {
+                exact_floats = argv[++a];
+            } else if (arg == "--format" && a + 1 < argc) {
+                format = CaseWriter::ParseFormat(argv[++a]);
+            } else if (arg == "--trace" && a + 1 < argc) {
+                trace_file = argv[++a];
+            } else {
+                throw std::runtime_error("未知的命令行参数: " + arg +
+                    "（用法: LSGameDataGen [--batch <规格文件>] [--output-dir <目录>] [--threads <n>] [--exact-floats <all|key,...>] [--format <csv|binary>] [--convert <算例文件>] [--trace <文件>]）");
+            }
+        }
+
+        // 无损浮点输出的key列表只检查一次：批量模式下不合法的列表会让每个算例各自失败
+        if (!exact_floats.empty()) {
+            CsvWriter::ValidateExactFloats(exact_floats);
+        }
+
+        if (!trace_file.empty()) {
+            PhaseTrace::Start();
+        }
+
+        //==============================================================================
+        // 转换模式：读取已有算例并按指定格式重新写出
+        //==============================================================================
+
+        if (!convert_file.empty()) {
+            logger.log("转换模式，算例文件: " + convert_file);
+
+            GeneratorConfig gc;
+            RunReport report;
+            {
+                ScopedPhaseTimer timer("read");
+                CaseReader::LoadParallel(convert_file, gc, threads);
+                timer.addRows(gc.demand.size());
+                timer.addBytes(std::filesystem::file_size(convert_file));
+                report.phase_nanos.emplace_back("read", timer.elapsedNanos());
+            }
+            logger.log("读取完成: U=" + std::to_string(gc.U) + " N=" + std::to_string(gc.N) +
+                       " G=" + std::to_string(gc.G) + " T=" + std::to_string(gc.T) +
+                       " 需求数=" + std::to_string(gc.demand.size()) +
+                       " 转运覆盖数=" + std::to_string(gc.transfer_costs.size()));
+
+            std::string cases_dir = output_dir.empty() ? BatchRunner::DefaultOutputDir() : output_dir;
+            OutputPaths::EnsureDirectory(cases_dir);
+            std::filesystem::path target = std::filesystem::path(cases_dir) /
+                std::filesystem::path(convert_file).stem();
+            target += CaseWriter::Extension(format);
+            if (std::filesystem::exists(target) &&
+                std::filesystem::equivalent(target, convert_file)) {
+                throw std::runtime_error("转换输出会覆盖输入文件: " + target.string());
+            }
+
+            {
+                ScopedPhaseTimer timer("write");
+                auto writer = CaseWriter::Open(target.string(), format, exact_floats);
+                report.sections = CaseGenerator::GenerateCsv(gc, *writer);
+                writer->close();
+                report.rows_written = writer->rowsWritten();
+                report.bytes_written = writer->bytesWritten();
+                timer.addRows(report.rows_written);
+                timer.addBytes(report.bytes_written);
+                report.phase_nanos.emplace_back("write", timer.elapsedNanos());
+            }
+
+            report.case_file = target.string();
+            report.format = CaseWriter::FormatName(format);
+            report.mode = "convert";
+            report.source_file = convert_file;
+
+            logger.log("输出文件: " + target.string());
+
+            // 输出与输入在同一目录时两者的报告同名，保留生成时写出的完整报告
+            std::filesystem::path input_report = RunReportWriter::SidecarPath(convert_file);
+            if (std::filesystem::exists(input_report) &&
+                std::filesystem::equivalent(input_report,
+                                            std::filesystem::path(target).replace_extension(".json"))) {
+                logger.log("保留原运行报告: " + input_report.string());
+            } else {
+                logger.log("运行报告: " + RunReportWriter::Write(report));
+            }
+            LogPhaseSummary(logger);
+            SaveTrace(logger, trace_file);
+            logger.log("==================== LS-Game-DataGen v2.0 完成 ====================");
+            logger.saveToFile();
+            return 0;
+        }
+
+        //==============================================================================
+        // 批量模式：按规格文件生成多个算例
+        //==============================================================================
+
+        if (!batch_file.empty()) {
+            logger.log("批量模式，规格文件: " + batch_file);
+
+            std::vector<CaseSpec> specs = CaseSpecLoader::LoadFile(batch_file);
+
+            BatchOptions options;
+            options.output_dir = output_dir;
+            options.threads = threads;
+            options.exact_floats = exact_floats;
+            options.format = format;
+            BatchResult result = BatchRunner::Run(specs, options, logger);
+
+            LogPhaseSummary(logger);
+            SaveTrace(logger, trace_file);
+            logger.log("==================== LS-Game-DataGen v2.0 完成 ====================");
+            logger.saveToFile();
+            return result.failed == 0 ? 0 : 1;
+        }
+
         //==============================================================================
         // 第一部分：基本规模参数配置
         //==============================================================================
@@ -160,6 +337,11 @@ int main() {
         double cI_min = 1.0;     // 库存成本最小值
         double cI_max = 1.0;     // 库存成本最大值
 
+        // 转运成本（当 enable_transfer = true 时使用）
+        double transfer_cost = 5.0;  // 基础转运成本（单位：元/件）
+        double transfer_cost_jitter = 0.0;  // 转运成本相对扰动幅度（0 = 统一成本；
+                                            // >0 时逐条成本在写出时流式产生，不占内存）
+
         //==============================================================================
         // 第六部分：随机种子
         //==============================================================================
@@ -169,92 +351,43 @@ int main() {
                                        // 便于实验的可重复性
 
         //==============================================================================
-        // 第七部分：构建配置对象
+        // 第七部分：构建算例规格
         //==============================================================================
 
-        // 构建算例生成配置
-        GeneratorConfig gc;
-        gc.U = U;
-        gc.N = N;
-        gc.G = G;
-        gc.T = T;
-        gc.enable_transfer = enable_transfer;
-
-        // 初始化物品-族关联矩阵 h_ig
-        // 策略：将物品均匀分配到各个族
-        gc.h_ig.assign(N * G, 0);
-        for (int i = 0; i < N; ++i) {
-            int assigned_family = i % G;  // 简单策略：物品i分配到族(i % G)
-            gc.h_ig[i * G + assigned_family] = 1;
-        }
-
-        // 填充成本向量
-        // 注意：cY 和 sY 现在是按族而非按物品
-        if (use_varied_costs) {
-            std::mt19937 cost_rng(demand_seed + 1000);
-            std::uniform_real_distribution<double> cY_dist(cY_min, cY_max);
-            std::uniform_real_distribution<double> cI_dist(cI_min, cI_max);
-
-            gc.cX.assign(N, unit_cX);
-
-            // cY 按族生成
-            for (int g = 0; g < G; ++g) {
-                gc.cY.push_back(cY_dist(cost_rng));
-            }
-
-            // cI 按物品生成
-            for (int i = 0; i < N; ++i) {
-                gc.cI.push_back(cI_dist(cost_rng));
-            }
-        } else {
-            gc.cX.assign(N, unit_cX);
-            gc.cY.assign(G, unit_cY);  // 注意：按族分配
-            gc.cI.assign(N, unit_cI);
-        }
-
-        // 填充产能占用向量
-        gc.sX.assign(N, unit_sX);
-        gc.sY.assign(G, unit_sY);  // 注意：按族分配
-
-        // 设置默认值
-        gc.default_capacity = default_capacity;
-
-        // 根据initial_inventory_ratio计算初始库存
-        // 需要先估算平均需求量
-        // 注意：setup overhead 现在按族计算
-        double total_capacity = U * T * default_capacity;
-        double estimated_setup_overhead = U * T * G * demand_intensity * unit_sY;
-        double available_production_capacity = total_capacity - estimated_setup_overhead;
-        double estimated_total_demand = available_production_capacity * capacity_utilization / unit_sX;
-        int estimated_demand_points = static_cast<int>(U * N * T * demand_intensity);
-        double avg_demand = (estimated_demand_points > 0) ?
-                           (estimated_total_demand / estimated_demand_points) : 0;
-
-        gc.default_i0 = avg_demand * initial_inventory_ratio;
+        CaseSpec spec;
+        spec.U = U;
+        spec.N = N;
+        spec.G = G;
+        spec.T = T;
+        spec.enable_transfer = enable_transfer;
+        spec.default_capacity = default_capacity;
+        spec.unit_sX = unit_sX;
+        spec.unit_sY = unit_sY;
+        spec.capacity_utilization = capacity_utilization;
+        spec.demand_intensity = demand_intensity;
+        spec.initial_inventory_ratio = initial_inventory_ratio;
+        spec.time_concentration = time_concentration;
+        spec.node_concentration = node_concentration;
+        spec.item_concentration = item_concentration;
+        spec.demand_size_variance = demand_size_variance;
+        spec.use_varied_costs = use_varied_costs;
+        spec.unit_cX = unit_cX;
+        spec.unit_cY = unit_cY;
+        spec.unit_cI = unit_cI;
+        spec.cY_min = cY_min;
+        spec.cY_max = cY_max;
+        spec.cI_min = cI_min;
+        spec.cI_max = cI_max;
+        spec.transfer_cost = transfer_cost;
+        spec.transfer_cost_jitter = transfer_cost_jitter;
+        spec.seed = demand_seed;
 
         //==============================================================================
-        // 第八部分：使用v2生成器生成需求数据
+        // 第八部分：使用v2生成器生成算例数据
         //==============================================================================
 
         logger.log("使用产能驱动生成器生成需求数据...");
 
-        // 构建需求生成配置对象
-        DemandGenConfig demand_config;
-        demand_config.U = U;
-        demand_config.N = N;
-        demand_config.T = T;
-        demand_config.default_capacity = default_capacity;
-        demand_config.unit_sX = unit_sX;
-        demand_config.unit_sY = unit_sY;
-        demand_config.capacity_utilization = capacity_utilization;
-        demand_config.demand_intensity = demand_intensity;
-        demand_config.initial_inventory_ratio = initial_inventory_ratio;
-        demand_config.time_concentration = time_concentration;
-        demand_config.node_concentration = node_concentration;
-        demand_config.item_concentration = item_concentration;
-        demand_config.random_seed = demand_seed;
-        demand_config.demand_size_variance = demand_size_variance;
-
         // 记录配置参数到日志
         logger.log("配置参数：");
         logger.log("  规模: U=" + std::to_string(U) + ", N=" + std::to_string(N) +
@@ -267,139 +400,43 @@ int main() {
         logger.log("  时间集中度: " + std::to_string(time_concentration));
         logger.log("  初始库存比例: " + std::to_string(initial_inventory_ratio));
 
-        // 调用生成器生成需求数据
-        gc.demand = DemandGenerator::Generate(demand_config);
-
-        // 记录生成的需求数量
-        logger.log("生成需求数量: " + std::to_string(gc.demand.size()));
-
-        // 计算并记录统计信息
-        if (!gc.demand.empty()) {
-            double total_demand_amount = 0.0;
-            for (const auto& d : gc.demand) {
-                total_demand_amount += d.amount;
-            }
-            double avg_demand_amount = total_demand_amount / gc.demand.size();
-            logger.log("总需求量: " + std::to_string(total_demand_amount));
-            logger.log("平均需求量: " + std::to_string(avg_demand_amount));
-
-            // 计算产能使用率
-            double total_production_capacity = total_demand_amount * unit_sX;
-            double total_available_capacity = U * T * default_capacity;
-            double actual_utilization = total_production_capacity / total_available_capacity;
-            logger.log("实际产能利用率: " + std::to_string(actual_utilization * 100) + "%");
+        // 构建完整的算例配置（成本、需求、转运、BigM）
+        GeneratorConfig gc;
+        CaseSummary summary = CaseBuilder::Build(spec, gc, threads);
+
+        // 记录生成的需求数量和统计信息
+        logger.log("生成需求数量: " + std::to_string(summary.demand_count));
+        logger.log("需求生成统计: " + summary.demand_stats.toString());
+        if (summary.demand_count > 0) {
+            logger.log("总需求量: " + std::to_string(summary.total_demand));
+            logger.log("平均需求量: " + std::to_string(summary.total_demand / summary.demand_count));
+            logger.log("实际产能利用率: " + std::to_string(summary.actual_utilization * 100) + "%");
         }
 
         //==============================================================================
-        // 第九部分：生成转运数据（仅当启用转运功能时）
+        // 第九部分：转运数据统计（仅当启用转运功能时）
         //==============================================================================
 
         if (enable_transfer) {
             logger.log("生成转运成本和BigM数据...");
-
-            // 转运成本配置
-            double transfer_cost = 5.0;  // 基础转运成本
-
-            // 生成转运成本数据 cT[u,v,i,t]
-            // 对于每个节点对、物品和时间的组合，设置转运成本
-            int transfer_count = 0;
-            for (int u = 0; u < U; ++u) {
-                for (int v = 0; v < U; ++v) {
-                    if (u == v) continue;  // 跳过自己到自己的转运
-
-                    for (int i = 0; i < N; ++i) {
-                        for (int t = 0; t < T; ++t) {
-                            TransferEntry te;
-                            te.u = u;
-                            te.v = v;
-                            te.i = i;
-                            te.t = t;
-                            te.cost = transfer_cost;  // 统一转运成本
-                            gc.transfer_costs.push_back(te);
-                            transfer_count++;
-                        }
-                    }
-                }
-            }
-
-            logger.log("生成转运成本条目数: " + std::to_string(transfer_count));
-
-            // 生成BigM约束数据 M[i,t]
-            // BigM需要足够大以确保约束正确工作
-            // 通常设置为所有需求的总和的2-3倍
-            double total_demand_sum = 0.0;
-            for (const auto& d : gc.demand) {
-                total_demand_sum += d.amount;
-            }
-            double bigM_value = std::max(10000.0, total_demand_sum * 2.0);
-
-            int bigM_count = 0;
-            for (int i = 0; i < N; ++i) {
-                for (int t = 0; t < T; ++t) {
-                    BigMEntry bm;
-                    bm.i = i;
-                    bm.t = t;
-                    bm.M = bigM_value;
-                    gc.bigM.push_back(bm);
-                    bigM_count++;
-                }
-            }
-
-            logger.log("生成BigM条目数: " + std::to_string(bigM_count));
-            logger.log("BigM值: " + std::to_string(bigM_value));
+            logger.log("默认转运成本: " + std::to_string(transfer_cost));
+            logger.log("生成转运成本覆盖条目数: " + std::to_string(summary.transfer_count));
+            logger.log("生成BigM覆盖条目数: " + std::to_string(summary.bigM_count));
+            logger.log("BigM值: " + std::to_string(summary.bigM_value));
         }
 
         //==============================================================================
         // 第十部分：生成输出文件名
         //==============================================================================
 
-        // 获取当前系统时间
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
-        std::tm tm_now;
-        localtime_s(&tm_now, &time_t_now);
-
-        // 获取项目根目录路径
-        std::string project_root = "";
-        std::string current_dir = ".";
-        for (int i = 0; i < 5; ++i) {
-            std::ifstream cmake_file(current_dir + "/CMakeLists.txt");
-            if (cmake_file.good()) {
-                project_root = current_dir;
-                break;
-            }
-            current_dir = "../" + current_dir;
-        }
-
-        if (project_root.empty()) {
-            project_root = ".";
-        }
-
-        std::string output_dir = project_root + "/output";
-        std::string cases_dir = output_dir + "/cases";
-
-        // 确保output和cases目录存在
-        #ifdef _WIN32
-            system(("if not exist \"" + output_dir + "\" mkdir \"" + output_dir + "\"").c_str());
-            system(("if not exist \"" + cases_dir + "\" mkdir \"" + cases_dir + "\"").c_str());
-        #else
-            system(("mkdir -p \"" + cases_dir + "\"").c_str());
-        #endif
+        // 确保输出目录存在
+        std::string cases_dir = output_dir.empty() ? BatchRunner::DefaultOutputDir() : output_dir;
+        OutputPaths::EnsureDirectory(cases_dir);
 
         // 构建文件名（保存到cases子目录）
-        std::ostringstream filename;
-        filename << cases_dir << "/case_"
-                 << std::setfill('0')
-                 << std::setw(4) << (tm_now.tm_year + 1900)
-                 << std::setw(2) << (tm_now.tm_mon + 1)
-                 << std::setw(2) << tm_now.tm_mday
-                 << "_"
-                 << std::setw(2) << tm_now.tm_hour
-                 << std::setw(2) << tm_now.tm_min
-                 << std::setw(2) << tm_now.tm_sec
-                 << ".csv";
-
-        std::string output_file = filename.str();
+        std::string output_file = cases_dir + "/case_" +
+                                  OutputPaths::FileStamp(OutputPaths::Now()) +
+                                  CaseWriter::Extension(format);
 
         //==============================================================================
         // 第十一部分：生成CSV算例文件
@@ -408,15 +445,39 @@ int main() {
         logger.log("开始生成算例文件...");
         logger.log("转运功能: " + std::string(gc.enable_transfer ? "启用" : "未启用"));
 
-        // 创建CSV写入器
-        CsvWriter writer(output_file);
+        RunReport report;
+        {
+            ScopedPhaseTimer timer("write");
+
+            // 创建算例写入器（CSV 或二进制）
+            auto writer = CaseWriter::Open(output_file, format, exact_floats);
+
+            // 调用生成器生成算例文件（CSV格式与v1.0兼容）
+            report.sections = CaseGenerator::GenerateCsv(gc, *writer);
+            writer->close();
+
+            report.rows_written = writer->rowsWritten();
+            report.bytes_written = writer->bytesWritten();
+            timer.addRows(report.rows_written);
+            timer.addBytes(report.bytes_written);
+            report.phase_nanos = {{"build", summary.build_nanos},
+                                  {"demand", summary.demand_nanos},
+                                  {"write", timer.elapsedNanos()}};
+        }
 
-        // 调用生成器生成CSV文件（与v1.0格式兼容）
-        CaseGenerator::GenerateCsv(gc, writer);
+        // 运行报告：与算例同名的 .json，记录生效配置、各段行数和耗时
+        report.case_file = output_file;
+        report.format = CaseWriter::FormatName(format);
+        report.mode = "single";
+        report.spec = &spec;
+        report.summary = &summary;
 
         // 记录成功信息
         logger.log("算例生成成功!");
         logger.log("输出文件: " + output_file);
+        logger.log("运行报告: " + RunReportWriter::Write(report));
+        LogPhaseSummary(logger);
+        SaveTrace(logger, trace_file);
         logger.log("==================== LS-Game-DataGen v2.0 完成 ====================");
 
         // 保存日志到文件
@@ -0,0 +1,115 @@
+/**
+ * ==================================================================================
+ * @file        mapped_file.cpp
+ * @brief       只读内存映射文件 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 MappedFile 的两个平台版本：
+ * - Windows: CreateFileA + CreateFileMappingA + MapViewOfFile
+ * - POSIX:   open + fstat + mmap(PROT_READ, MAP_PRIVATE)，并提示内核顺序读取
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "mapped_file.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+/**
+ * @brief 构造函数实现（Windows）
+ */
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+    file_ = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw std::runtime_error("无法获取文件大小: " + path);
+    }
+    size_ = static_cast<size_t>(size.QuadPart);
+    if (size_ == 0) return;  // 空文件无法映射
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    mapping_ = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    data_ = static_cast<const char*>(view);
+}
+
+/**
+ * @brief 析构函数实现（Windows）
+ */
+MappedFile::~MappedFile() {
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(static_cast<HANDLE>(mapping_));
+    if (file_) CloseHandle(static_cast<HANDLE>(file_));
+}
+
+#else
+
+/**
+ * @brief 构造函数实现（POSIX）
+ */
+MappedFile::MappedFile(const std::string& path) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        ::close(fd_);
+        throw std::runtime_error("无法获取文件大小: " + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) return;  // 空文件无法映射
+
+    void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (addr == MAP_FAILED) {
+        ::close(fd_);
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    // 解析是一次顺序扫描，提示内核加大预读
+    ::madvise(addr, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(addr);
+}
+
+/**
+ * @brief 析构函数实现（POSIX）
+ */
+MappedFile::~MappedFile() {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    if (fd_ >= 0) ::close(fd_);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * ==================================================================================
+ * @file        mapped_file.h
+ * @brief       只读内存映射文件 - 头文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * MappedFile 以只读方式把整个文件映射到内存（POSIX mmap / Windows CreateFileMapping），
+ * 通过 view() 以 std::string_view 访问文件内容，不做任何拷贝。
+ *
+ * 使用示例：
+ * @code
+ * MappedFile file("case.csv");
+ * std::string_view text = file.view();
+ * @endcode
+ *
+ * @note 空文件不建立映射，view() 返回空视图
+ * @note 映射在析构时解除，view() 返回的视图不能比对象活得更久
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief 只读内存映射文件（RAII）
+ */
+class MappedFile {
+public:
+    /**
+     * @brief 构造函数 - 打开并映射文件
+     *
+     * @param path 文件路径
+     *
+     * @throw std::runtime_error 当文件无法打开或映射失败时抛出异常
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief 析构函数 - 解除映射并关闭文件
+     */
+    ~MappedFile();
+
+    // 禁用拷贝：映射和文件句柄只能有一个所有者
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief 文件内容起始地址（空文件为 nullptr）
+     */
+    const char* data() const { return data_; }
+
+    /**
+     * @brief 文件字节数
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief 以 string_view 访问整个文件内容
+     */
+    std::string_view view() const { return std::string_view(data_, size_); }
+
+private:
+    const char* data_ = nullptr;  ///< 映射起始地址
+    size_t size_ = 0;             ///< 文件字节数
+
+#ifdef _WIN32
+    void* file_ = nullptr;        ///< 文件句柄（HANDLE）
+    void* mapping_ = nullptr;     ///< 映射句柄（HANDLE）
+#else
+    int fd_ = -1;                 ///< 文件描述符
+#endif
+};
@@ -0,0 +1,103 @@
+/**
+ * ==================================================================================
+ * @file        mem_stats.cpp
+ * @brief       内存统计（分配计数与峰值常驻内存）- 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 定义 DATAGEN_ALLOC_TRACKING 时，本文件替换全局 operator new / delete：
+ * 分配仍由 malloc 完成，只额外累加调用线程的计数器；释放直接交给 free。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "mem_stats.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// ====================================================================================
+// 分配计数
+// ====================================================================================
+
+namespace {
+
+/// 调用线程的累计分配（平凡类型的 thread_local，无需构造，operator new 中可安全使用）
+thread_local AllocSample t_allocations;
+
+}  // namespace
+
+#ifdef DATAGEN_ALLOC_TRACKING
+
+namespace {
+
+void* CountedAlloc(std::size_t size) noexcept {
+    if (size == 0) size = 1;
+    ++t_allocations.allocations;
+    t_allocations.bytes += size;
+    return std::malloc(size);
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    void* p = CountedAlloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    void* p = CountedAlloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+#endif  // DATAGEN_ALLOC_TRACKING
+
+// ====================================================================================
+// MemStats 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 调用线程至今的累计分配
+ */
+AllocSample MemStats::ThreadAllocations() {
+    return t_allocations;
+}
+
+/**
+ * @brief 进程的峰值常驻内存
+ *
+ * @details /proc/self/status 中形如 "VmHWM:    123456 kB" 的一行
+ */
+uint64_t MemStats::PeakRssBytes() {
+#ifdef __linux__
+    FILE* f = std::fopen("/proc/self/status", "r");
+    if (!f) return 0;
+    char line[256];
+    unsigned long long kb = 0;
+    while (std::fgets(line, sizeof(line), f)) {
+        if (std::strncmp(line, "VmHWM:", 6) == 0) {
+            std::sscanf(line + 6, "%llu", &kb);
+            break;
+        }
+    }
+    std::fclose(f);
+    return static_cast<uint64_t>(kb) * 1024;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,68 @@
+/**
+ * ==================================================================================
+ * @file        mem_stats.h
+ * @brief       内存统计（分配计数与峰值常驻内存）- 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 1. 分配计数（可选，CMake 选项 DATAGEN_ALLOC_TRACKING=ON 时编译进来）
+ *    mem_stats.cpp 替换全局 operator new / delete，每次分配在调用线程的
+ *    thread_local 计数器上累加次数和字节数（无锁、无原子操作）。
+ *    ScopedPhaseTimer 在开始和结束时读取计数，把差值记入该阶段的 PhaseStats，
+ *    因此工作线程上的分配计入工作线程上的阶段（如并行需求生成的 points）。
+ *
+ * 2. 峰值常驻内存（总是可用）
+ *    Linux 读取 /proc/self/status 的 VmHWM 行，其他平台返回0。
+ *
+ * 使用示例：
+ * @code
+ * cmake -S . -B build -DDATAGEN_ALLOC_TRACKING=ON
+ * ...
+ * uint64_t peak = MemStats::PeakRssBytes();   // 运行结束时记录，用于设置作业内存上限
+ * @endcode
+ *
+ * @note 只统计 operator new（含数组和 nothrow 形式），不含 malloc 和超对齐的 new
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <cstdint>
+
+/**
+ * @struct AllocSample
+ * @brief  分配次数和字节数（累计值或差值）
+ */
+struct AllocSample {
+    uint64_t allocations = 0;  ///< 分配次数
+    uint64_t bytes = 0;        ///< 申请的字节数
+
+    AllocSample since(const AllocSample& earlier) const {
+        return {allocations - earlier.allocations, bytes - earlier.bytes};
+    }
+};
+
+/**
+ * @class MemStats
+ * @brief 内存统计（静态类）
+ */
+class MemStats {
+public:
+#ifdef DATAGEN_ALLOC_TRACKING
+    static constexpr bool kAllocTracking = true;
+#else
+    static constexpr bool kAllocTracking = false;   ///< 是否编译了分配计数
+#endif
+
+    /**
+     * @brief 调用线程至今的累计分配（未编译分配计数时为0）
+     */
+    static AllocSample ThreadAllocations();
+
+    /**
+     * @brief 进程的峰值常驻内存（字节，VmHWM；不可用时为0）
+     */
+    static uint64_t PeakRssBytes();
+};
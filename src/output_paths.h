@@ -0,0 +1,116 @@
+/**
+ * ==================================================================================
+ * @file        output_paths.h
+ * @brief       输出路径与时间戳工具 - 头文件和实现
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 集中管理输出目录定位、目录创建和时间戳格式化，供 Logger、主程序和
+ * 批量生成器共用，避免每个调用点各自探测项目根目录、调用 system("mkdir")。
+ *
+ * 主要功能：
+ * - 向上查找包含 CMakeLists.txt 的项目根目录
+ * - 跨平台创建目录（std::filesystem，不再依赖 shell 命令）
+ * - 线程安全的本地时间转换（Windows: localtime_s，POSIX: localtime_r）
+ * - 生成 YYYYMMDD_HHMMSS 格式的文件名时间戳
+ *
+ * @note 本文件采用header-only设计，所有实现都在头文件中
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <stdexcept>
+
+/**
+ * @class OutputPaths
+ * @brief 输出路径与时间戳工具静态类
+ *
+ * @note 所有方法都是静态的，不需要创建实例
+ */
+class OutputPaths {
+public:
+    /**
+     * @brief 查找项目根目录（向上查找包含CMakeLists.txt的目录）
+     *
+     * @return std::string 项目根目录路径；最多向上查找5级，找不到时返回"."
+     */
+    static std::string FindProjectRoot() {
+        std::string current_dir = ".";
+        for (int i = 0; i < 5; ++i) {  // 最多向上查找5级目录
+            std::ifstream cmake_file(current_dir + "/CMakeLists.txt");
+            if (cmake_file.good()) {
+                return current_dir;
+            }
+            current_dir = "../" + current_dir;
+        }
+        return ".";
+    }
+
+    /**
+     * @brief 确保目录存在（递归创建）
+     *
+     * @param dir 目录路径
+     *
+     * @throw std::runtime_error 当目录无法创建时抛出异常
+     */
+    static void EnsureDirectory(const std::string& dir) {
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+        if (ec && !std::filesystem::is_directory(dir)) {
+            throw std::runtime_error("无法创建目录: " + dir + " (" + ec.message() + ")");
+        }
+    }
+
+    /**
+     * @brief 线程安全地将 time_t 转换为本地时间
+     *
+     * @param t 时间点
+     * @return std::tm 本地时间
+     */
+    static std::tm LocalTime(std::time_t t) {
+        std::tm tm_now{};
+        #ifdef _WIN32
+            localtime_s(&tm_now, &t);
+        #else
+            localtime_r(&t, &tm_now);
+        #endif
+        return tm_now;
+    }
+
+    /**
+     * @brief 获取当前本地时间
+     */
+    static std::tm Now() {
+        auto now = std::chrono::system_clock::now();
+        return LocalTime(std::chrono::system_clock::to_time_t(now));
+    }
+
+    /**
+     * @brief 格式化文件名时间戳
+     *
+     * @param tm_now 本地时间
+     * @return std::string 格式为 YYYYMMDD_HHMMSS
+     */
+    static std::string FileStamp(const std::tm& tm_now) {
+        std::ostringstream oss;
+        oss << std::setfill('0')
+            << std::setw(4) << (tm_now.tm_year + 1900)  // 年份
+            << std::setw(2) << (tm_now.tm_mon + 1)      // 月份
+            << std::setw(2) << tm_now.tm_mday           // 日期
+            << "_"
+            << std::setw(2) << tm_now.tm_hour           // 小时
+            << std::setw(2) << tm_now.tm_min            // 分钟
+            << std::setw(2) << tm_now.tm_sec;           // 秒
+        return oss.str();
+    }
+};
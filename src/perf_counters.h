@@ -0,0 +1,117 @@
+/**
+ * ==================================================================================
+ * @file        perf_counters.h
+ * @brief       硬件性能计数器 (Linux perf_event_open) - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 为 ScopedPhaseTimer 提供可选的硬件计数：周期数、指令数、缓存未命中、分支预测失败。
+ * 四个计数器作为一个 perf 事件组打开，一次 read() 原子地读出全部计数。
+ *
+ * - 只统计用户态（exclude_kernel / exclude_hv），perf_event_paranoid ≤ 2 时普通用户可用
+ * - 计数器组按线程在首次读取时打开，只统计调用线程自身的事件
+ * - 累计值保存原始计数与启用/运行时间；计数器被内核复用（multiplexing）时，
+ *   差值按该区间内的 启用时间/运行时间 比例折算
+ * - 非 Linux 平台、内核禁止或硬件不支持时 Enable() 返回 false，计时照常进行
+ *
+ * 使用示例：
+ * @code
+ * std::string reason;
+ * if (!PerfCounters::Enable(reason)) std::printf("硬件计数器不可用: %s\n", reason.c_str());
+ * // 之后所有 ScopedPhaseTimer 自动记录计数差值，见 PhaseStats::counters
+ * @endcode
+ *
+ * @note 工作线程上的事件不计入在主线程上计时的阶段（如多线程需求生成）
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @struct PerfSample
+ * @brief  一组硬件计数值（累计值或差值）
+ *
+ * @details
+ * 累计值是未折算的原始计数；since() 得到的差值已按复用比例折算。
+ * 先折算累计值再相减时，两次读取的折算比例不同，差值可能为负（无符号回绕）。
+ */
+struct PerfSample {
+    uint64_t cycles = 0;          ///< CPU 周期数
+    uint64_t instructions = 0;    ///< 退休指令数
+    uint64_t cache_misses = 0;    ///< 末级缓存未命中次数
+    uint64_t branch_misses = 0;   ///< 分支预测失败次数
+    uint64_t time_enabled = 0;    ///< 计数器组启用时间（纳秒）
+    uint64_t time_running = 0;    ///< 计数器组实际在 PMU 上运行的时间（纳秒，复用时小于启用时间）
+
+    /**
+     * @brief 累加另一组计数
+     */
+    void add(const PerfSample& other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cache_misses += other.cache_misses;
+        branch_misses += other.branch_misses;
+        time_enabled += other.time_enabled;
+        time_running += other.time_running;
+    }
+
+    /**
+     * @brief 本组相对于更早一组的差值
+     *
+     * @details
+     * 原始计数相减后按 Δ启用时间/Δ运行时间 折算；各项差值不小于0。
+     */
+    PerfSample since(const PerfSample& earlier) const {
+        auto raw = [](uint64_t later, uint64_t before) { return later > before ? later - before : 0; };
+        PerfSample delta;
+        delta.time_enabled = raw(time_enabled, earlier.time_enabled);
+        delta.time_running = raw(time_running, earlier.time_running);
+        double scale = (delta.time_running > 0 && delta.time_running < delta.time_enabled)
+                           ? static_cast<double>(delta.time_enabled) / delta.time_running : 1.0;
+        auto scaled = [&](uint64_t later, uint64_t before) {
+            return static_cast<uint64_t>(static_cast<double>(raw(later, before)) * scale);
+        };
+        delta.cycles = scaled(cycles, earlier.cycles);
+        delta.instructions = scaled(instructions, earlier.instructions);
+        delta.cache_misses = scaled(cache_misses, earlier.cache_misses);
+        delta.branch_misses = scaled(branch_misses, earlier.branch_misses);
+        return delta;
+    }
+};
+
+/**
+ * @class PerfCounters
+ * @brief 进程级硬件计数开关与按线程读取（静态类）
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief 在调用线程上试开计数器组，成功后全局启用
+     *
+     * @param reason 失败时的原因（如 "perf_event_open: Permission denied"）
+     * @return bool 是否启用
+     */
+    static bool Enable(std::string& reason);
+
+    /**
+     * @brief 是否已启用（热路径上的一次原子读）
+     */
+    static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 读取调用线程的累计计数（首次调用时为该线程打开计数器组）
+     *
+     * @param sample 输出的累计计数（原始值，未按复用比例折算）
+     * @return bool 该线程的计数器组是否可用
+     */
+    static bool Read(PerfSample& sample);
+
+private:
+    static inline std::atomic<bool> enabled_{false};
+};
@@ -0,0 +1,135 @@
+/**
+ * ==================================================================================
+ * @file        phase_timer.cpp
+ * @brief       阶段计时器 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 PhaseTimers 的统计表：
+ * - 统计项按首次出现顺序保存在数组中，阶段数很少，按名称线性查找
+ * - 每次记录只在互斥锁内做一次查找和几次加法
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "phase_timer.h"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+// ====================================================================================
+// 统计表存储
+// ====================================================================================
+
+namespace {
+
+std::mutex g_phase_mutex;              ///< 保护 g_phases
+std::vector<PhaseStats> g_phases;      ///< 各阶段统计（按首次出现顺序）
+
+}  // namespace
+
+// ====================================================================================
+// PhaseTimers 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 累加一次计时结果
+ */
+void PhaseTimers::Record(std::string_view name, uint64_t nanos, uint64_t rows, uint64_t bytes,
+                         const PerfSample* counters, AllocSample allocations) {
+    std::lock_guard<std::mutex> lock(g_phase_mutex);
+    auto it = std::find_if(g_phases.begin(), g_phases.end(),
+                           [&](const PhaseStats& stats) { return stats.name == name; });
+    if (it == g_phases.end()) {
+        it = g_phases.emplace(g_phases.end());
+        it->name = name;
+    }
+    ++it->calls;
+    it->nanos += nanos;
+    it->rows += rows;
+    it->bytes += bytes;
+    it->allocations.allocations += allocations.allocations;
+    it->allocations.bytes += allocations.bytes;
+    if (counters) {
+        ++it->counted_calls;
+        it->counters.add(*counters);
+    }
+}
+
+/**
+ * @brief 当前所有阶段的统计
+ */
+std::vector<PhaseStats> PhaseTimers::Snapshot() {
+    std::lock_guard<std::mutex> lock(g_phase_mutex);
+    return g_phases;
+}
+
+/**
+ * @brief 清空所有统计
+ */
+void PhaseTimers::Reset() {
+    std::lock_guard<std::mutex> lock(g_phase_mutex);
+    g_phases.clear();
+}
+
+/**
+ * @brief 格式化的汇总表
+ *
+ * @details
+ * 列：阶段、次数、总耗时(ms)、平均耗时(ms)、行数、行/秒、MB、MB/秒。
+ * 没有行数或字节数的阶段，对应的吞吐列显示为 "-"。
+ * 编译了分配计数时另附一张表：各阶段的分配次数、分配MB和每次计时的平均分配次数。
+ */
+std::vector<std::string> PhaseTimers::SummaryTable() {
+    std::vector<PhaseStats> phases = Snapshot();
+    std::vector<std::string> lines;
+    if (phases.empty()) return lines;
+
+    char buf[256];
+    std::snprintf(buf, sizeof(buf), "%-12s %8s %12s %10s %12s %12s %10s %9s",
+                  "phase", "calls", "total_ms", "avg_ms", "rows", "rows/s", "MB", "MB/s");
+    lines.emplace_back("阶段耗时汇总（多线程时为各线程耗时之和）:");
+    lines.emplace_back(buf);
+
+    for (const PhaseStats& p : phases) {
+        double ms = static_cast<double>(p.nanos) / 1e6;
+        double seconds = static_cast<double>(p.nanos) / 1e9;
+        double mb = static_cast<double>(p.bytes) / (1024.0 * 1024.0);
+
+        char rows_rate[32] = "-";
+        char mb_total[32] = "-";
+        char mb_rate[32] = "-";
+        if (p.rows > 0 && seconds > 0) {
+            std::snprintf(rows_rate, sizeof(rows_rate), "%.0f", static_cast<double>(p.rows) / seconds);
+        }
+        if (p.bytes > 0) {
+            std::snprintf(mb_total, sizeof(mb_total), "%.2f", mb);
+            if (seconds > 0) std::snprintf(mb_rate, sizeof(mb_rate), "%.1f", mb / seconds);
+        }
+
+        std::snprintf(buf, sizeof(buf), "%-12s %8llu %12.3f %10.3f %12llu %12s %10s %9s",
+                      p.name.c_str(),
+                      static_cast<unsigned long long>(p.calls),
+                      ms, ms / static_cast<double>(p.calls),
+                      static_cast<unsigned long long>(p.rows),
+                      rows_rate, mb_total, mb_rate);
+        lines.emplace_back(buf);
+    }
+
+    if (MemStats::kAllocTracking) {
+        lines.emplace_back("阶段内存分配（operator new，含嵌套阶段）:");
+        std::snprintf(buf, sizeof(buf), "%-12s %14s %12s %14s", "phase", "allocs", "alloc_MB", "allocs/call");
+        lines.emplace_back(buf);
+        for (const PhaseStats& p : phases) {
+            std::snprintf(buf, sizeof(buf), "%-12s %14llu %12.2f %14.1f",
+                          p.name.c_str(),
+                          static_cast<unsigned long long>(p.allocations.allocations),
+                          static_cast<double>(p.allocations.bytes) / (1024.0 * 1024.0),
+                          static_cast<double>(p.allocations.allocations) / static_cast<double>(p.calls));
+            lines.emplace_back(buf);
+        }
+    }
+    return lines;
+}
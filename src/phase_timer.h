@@ -0,0 +1,182 @@
+/**
+ * ==================================================================================
+ * @file        phase_timer.h
+ * @brief       阶段计时器 - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * ScopedPhaseTimer 在构造时读取单调时钟（std::chrono::steady_clock，纳秒分辨率），
+ * 析构时把耗时连同处理的行数、字节数累加到 PhaseTimers 中同名阶段的统计上。
+ * 运行结束时 PhaseTimers::SummaryTable() 给出各阶段的次数、总耗时、行/秒和MB/秒。
+ *
+ * 已接入的阶段：
+ * - case:     批量模式中的一个算例（含 build、write），说明为算例文件名
+ * - build:    CaseBuilder::Build（含 demand）
+ * - demand:   DemandGenerator::Generate，行数为需求点数（含以下四个子阶段）
+ * - weights:  产能、时段/节点/物品权重和物品别名表
+ * - allocate: 把需求点数分配到各(u,t)
+ * - points:   生成一段(u,t)区间的需求点（并行时每个任务一次），行数为点数
+ * - feasibility: 可行性验证
+ * - validate: CaseGenerator::Validate
+ * - write:    写出一个算例文件（含 validate、transfer），行数和字节数取自写入器
+ * - transfer: 写出转运成本和BigM段，行数为写出的 cT / M 行数
+ * - read:     读取算例文件（转换模式），字节数为文件大小
+ *
+ * 使用示例：
+ * @code
+ * {
+ *     ScopedPhaseTimer timer("write");
+ *     CaseGenerator::GenerateCsv(gc, *writer);
+ *     timer.addRows(writer->rowsWritten());
+ *     timer.addBytes(writer->bytesWritten());
+ * }
+ * for (const std::string& line : PhaseTimers::SummaryTable()) logger.log(line);
+ * @endcode
+ *
+ * @note 多线程同时计时时，同名阶段的耗时按线程累加（CPU墙钟时间之和，不是批次总耗时）
+ * @note PerfCounters 启用后，每次计时同时记录调用线程的硬件计数差值（见 perf_counters.h）
+ * @note PhaseTrace 启用后，每次计时同时记录一个带线程号的跟踪事件（见 phase_trace.h）
+ * @note 编译了分配计数（DATAGEN_ALLOC_TRACKING）时，每次计时同时记录调用线程的分配次数和字节数（见 mem_stats.h）
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "mem_stats.h"
+#include "perf_counters.h"
+#include "phase_trace.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct PhaseStats
+ * @brief  一个阶段的累计统计
+ */
+struct PhaseStats {
+    std::string name;     ///< 阶段名称
+    uint64_t calls = 0;   ///< 计时次数
+    uint64_t nanos = 0;   ///< 总耗时（纳秒）
+    uint64_t rows = 0;    ///< 处理的行数
+    uint64_t bytes = 0;   ///< 处理的字节数
+    uint64_t counted_calls = 0;  ///< 带硬件计数的计时次数（未启用 PerfCounters 时为0）
+    PerfSample counters;         ///< 硬件计数差值之和
+    AllocSample allocations;     ///< 阶段内的分配次数和字节数（未编译分配计数时为0）
+};
+
+/**
+ * @class PhaseTimers
+ * @brief 进程内的阶段统计表（静态类，线程安全）
+ */
+class PhaseTimers {
+public:
+    /**
+     * @brief 累加一次计时结果
+     *
+     * @param name  阶段名称
+     * @param nanos 耗时（纳秒）
+     * @param rows  处理的行数
+     * @param bytes 处理的字节数
+     * @param counters 硬件计数差值（未采集时为 nullptr）
+     * @param allocations 阶段内的分配
+     */
+    static void Record(std::string_view name, uint64_t nanos, uint64_t rows, uint64_t bytes,
+                       const PerfSample* counters = nullptr, AllocSample allocations = {});
+
+    /**
+     * @brief 当前所有阶段的统计（按首次出现的顺序）
+     */
+    static std::vector<PhaseStats> Snapshot();
+
+    /**
+     * @brief 清空所有统计
+     */
+    static void Reset();
+
+    /**
+     * @brief 格式化的汇总表（每个元素一行，不含换行符；没有任何统计时为空）
+     */
+    static std::vector<std::string> SummaryTable();
+};
+
+/**
+ * @class ScopedPhaseTimer
+ * @brief RAII 阶段计时器：析构时把耗时记入 PhaseTimers
+ *
+ * @note 不可复制；阶段名称在析构前必须保持有效（通常为字符串字面量）
+ */
+class ScopedPhaseTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief 构造函数 - 开始计时
+     *
+     * @param name 阶段名称
+     */
+    explicit ScopedPhaseTimer(std::string_view name) : name_(name) {
+        if (PerfCounters::Enabled()) perf_ok_ = PerfCounters::Read(perf_start_);
+        if (MemStats::kAllocTracking) alloc_start_ = MemStats::ThreadAllocations();
+        start_ = Clock::now();
+    }
+
+    /**
+     * @brief 析构函数 - 结束计时并记录
+     */
+    ~ScopedPhaseTimer() {
+        Clock::time_point end = Clock::now();
+        uint64_t nanos = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_).count());
+        if (PhaseTrace::Enabled()) PhaseTrace::Record(name_, start_, end, rows_, bytes_, detail_);
+        AllocSample allocations;
+        if (MemStats::kAllocTracking) allocations = MemStats::ThreadAllocations().since(alloc_start_);
+        PerfSample perf_end;
+        if (perf_ok_ && PerfCounters::Read(perf_end)) {
+            PerfSample delta = perf_end.since(perf_start_);
+            PhaseTimers::Record(name_, nanos, rows_, bytes_, &delta, allocations);
+        } else {
+            PhaseTimers::Record(name_, nanos, rows_, bytes_, nullptr, allocations);
+        }
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+    /**
+     * @brief 累加本阶段处理的行数
+     */
+    void addRows(uint64_t rows) { rows_ += rows; }
+
+    /**
+     * @brief 累加本阶段处理的字节数
+     */
+    void addBytes(uint64_t bytes) { bytes_ += bytes; }
+
+    /**
+     * @brief 设置跟踪事件的说明（只用于 PhaseTrace，不影响统计）
+     */
+    void setDetail(std::string detail) { detail_ = std::move(detail); }
+
+    /**
+     * @brief 从构造到现在的耗时（纳秒）
+     */
+    uint64_t elapsedNanos() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count());
+    }
+
+private:
+    std::string_view name_;   ///< 阶段名称
+    Clock::time_point start_; ///< 开始时间
+    uint64_t rows_ = 0;       ///< 处理的行数
+    uint64_t bytes_ = 0;      ///< 处理的字节数
+    bool perf_ok_ = false;    ///< 开始时是否读到了硬件计数
+    PerfSample perf_start_;   ///< 开始时的硬件计数
+    AllocSample alloc_start_; ///< 开始时调用线程的累计分配
+    std::string detail_;      ///< 跟踪事件的说明
+};
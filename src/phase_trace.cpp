@@ -0,0 +1,147 @@
+/**
+ * ==================================================================================
+ * @file        phase_trace.cpp
+ * @brief       阶段跟踪 (Chrome trace-event 格式) - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 PhaseTrace 的事件缓冲和 JSON 输出：
+ * - 线程号按线程首次记录的顺序从1开始分配（thread_local），并输出 thread_name 元数据
+ * - 时间戳为相对 Start() 的微秒数（trace-event 格式的默认单位）
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "phase_trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// ====================================================================================
+// 事件存储
+// ====================================================================================
+
+namespace {
+
+/**
+ * @struct TraceEvent
+ * @brief  一个已结束的阶段
+ */
+struct TraceEvent {
+    std::string name;
+    std::string detail;
+    double ts_us;      ///< 开始时间（相对时间原点，微秒）
+    double dur_us;     ///< 持续时间（微秒）
+    int tid;           ///< 线程号
+    uint64_t rows;
+    uint64_t bytes;
+};
+
+std::mutex g_trace_mutex;                  ///< 保护以下变量
+std::vector<TraceEvent> g_events;          ///< 已记录的事件
+PhaseTrace::Clock::time_point g_origin;    ///< 时间原点
+std::atomic<int> g_next_tid{1};            ///< 下一个线程号
+
+/**
+ * @brief 调用线程的线程号
+ */
+int LocalTid() {
+    thread_local int tid = g_next_tid.fetch_add(1, std::memory_order_relaxed);
+    return tid;
+}
+
+/**
+ * @brief 按 JSON 字符串规则转义
+ */
+std::string EscapeJson(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+// ====================================================================================
+// PhaseTrace 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 开始记录
+ */
+void PhaseTrace::Start() {
+    std::lock_guard<std::mutex> lock(g_trace_mutex);
+    g_events.clear();
+    g_origin = Clock::now();
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 记录调用线程上的一个阶段
+ */
+void PhaseTrace::Record(std::string_view name, Clock::time_point begin, Clock::time_point end,
+                        uint64_t rows, uint64_t bytes, std::string_view detail) {
+    int tid = LocalTid();
+    std::lock_guard<std::mutex> lock(g_trace_mutex);
+    using Micros = std::chrono::duration<double, std::micro>;
+    g_events.push_back({std::string(name), std::string(detail),
+                        Micros(begin - g_origin).count(), Micros(end - begin).count(),
+                        tid, rows, bytes});
+}
+
+/**
+ * @brief 把已记录的事件写成 trace-event JSON 文件
+ */
+size_t PhaseTrace::Save(const std::string& path) {
+    std::lock_guard<std::mutex> lock(g_trace_mutex);
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) throw std::runtime_error("无法创建跟踪文件: " + path);
+
+    std::fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    std::fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+                    "\"args\":{\"name\":\"LSGameDataGen\"}}");
+
+    int max_tid = 0;
+    for (const TraceEvent& e : g_events) max_tid = std::max(max_tid, e.tid);
+    for (int tid = 1; tid <= max_tid; ++tid) {
+        std::fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                        "\"args\":{\"name\":\"thread %d\"}}", tid, tid);
+    }
+
+    for (const TraceEvent& e : g_events) {
+        std::fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                        "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"rows\":%llu,\"bytes\":%llu",
+                     EscapeJson(e.name).c_str(), e.tid, e.ts_us, e.dur_us,
+                     static_cast<unsigned long long>(e.rows),
+                     static_cast<unsigned long long>(e.bytes));
+        if (!e.detail.empty()) {
+            std::fprintf(f, ",\"detail\":\"%s\"", EscapeJson(e.detail).c_str());
+        }
+        std::fprintf(f, "}}");
+    }
+    std::fprintf(f, "\n]}\n");
+
+    bool ok = std::fclose(f) == 0;
+    if (!ok) throw std::runtime_error("写入跟踪文件失败: " + path);
+    return g_events.size();
+}
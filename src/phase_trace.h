@@ -0,0 +1,80 @@
+/**
+ * ==================================================================================
+ * @file        phase_trace.h
+ * @brief       阶段跟踪 (Chrome trace-event 格式) - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 启用后，每个 ScopedPhaseTimer 结束时记录一个带线程号的事件（开始时间、持续时间、
+ * 行数、字节数和可选的说明），运行结束时写成 Chrome trace-event JSON：
+ * 可直接在 chrome://tracing 或 https://ui.perfetto.dev 中打开，
+ * 按线程查看各算例、各阶段的时间线，定位并行批次中的慢算例和负载不均。
+ *
+ * 事件使用 "X"（complete）类型：一个事件同时给出开始和结束，与一对 B/E 事件等价，
+ * 嵌套阶段（如 build 内的 demand）在同一线程上显示为层叠的区间。
+ *
+ * 使用示例：
+ * @code
+ * PhaseTrace::Start();                 // 之后的 ScopedPhaseTimer 都会被记录
+ * ...
+ * size_t n = PhaseTrace::Save("trace.json");
+ * @endcode
+ *
+ * @note 未启用时 ScopedPhaseTimer 只多一次原子读；启用后每个事件在互斥锁内追加一次
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class PhaseTrace
+ * @brief 进程内的阶段事件记录（静态类，线程安全）
+ */
+class PhaseTrace {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief 开始记录（以当前时刻为时间原点，清空已有事件）
+     */
+    static void Start();
+
+    /**
+     * @brief 是否正在记录（热路径上的一次原子读）
+     */
+    static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 记录调用线程上的一个阶段
+     *
+     * @param name   阶段名称
+     * @param begin  开始时刻
+     * @param end    结束时刻
+     * @param rows   处理的行数
+     * @param bytes  处理的字节数
+     * @param detail 说明（如算例文件名，可为空）
+     */
+    static void Record(std::string_view name, Clock::time_point begin, Clock::time_point end,
+                       uint64_t rows, uint64_t bytes, std::string_view detail);
+
+    /**
+     * @brief 把已记录的事件写成 trace-event JSON 文件
+     *
+     * @param path 输出文件路径
+     * @return size_t 写出的阶段事件数
+     *
+     * @throw std::runtime_error 当文件无法创建时抛出异常
+     */
+    static size_t Save(const std::string& path);
+
+private:
+    static inline std::atomic<bool> enabled_{false};
+};
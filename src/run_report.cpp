@@ -0,0 +1,207 @@
+/**
+ * ==================================================================================
+ * @file        run_report.cpp
+ * @brief       算例运行报告（JSON 附属文件）- 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 报告在内存中拼成一个字符串后一次写出；浮点数用最短往返表示（std::to_chars），
+ * 读回后与生成时的值逐位相同。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "run_report.h"
+#include "output_paths.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+// ====================================================================================
+// JSON 拼接辅助
+// ====================================================================================
+
+namespace {
+
+/**
+ * @brief 追加带引号并按 JSON 规则转义的字符串
+ */
+void AppendString(std::string& out, std::string_view text) {
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+/**
+ * @brief 追加浮点数（最短往返表示；JSON 没有 inf / nan，非有限值写为 null）
+ */
+void AppendReal(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+/**
+ * @brief 追加 "key": 前缀（缩进 indent 个空格）
+ */
+void AppendKey(std::string& out, int indent, std::string_view key) {
+    out.append(static_cast<size_t>(indent), ' ');
+    AppendString(out, key);
+    out += ": ";
+}
+
+}  // namespace
+
+// ====================================================================================
+// RunReportWriter 类方法实现
+// ====================================================================================
+
+/**
+ * @brief 算例文件对应的报告路径
+ */
+std::string RunReportWriter::SidecarPath(const std::string& case_file) {
+    return std::filesystem::path(case_file).replace_extension(".json").string();
+}
+
+/**
+ * @brief 写出报告
+ */
+std::string RunReportWriter::Write(const RunReport& report) {
+    std::string out = "{\n";
+    auto field = [&](std::string_view key) {
+        if (out.size() > 2) out += ",\n";
+        AppendKey(out, 2, key);
+    };
+
+    field("generator");
+    AppendString(out, "LSGameDataGen");
+    field("created");
+    AppendString(out, OutputPaths::FileStamp(OutputPaths::Now()));
+    field("mode");
+    AppendString(out, report.mode);
+    field("case_file");
+    AppendString(out, std::filesystem::path(report.case_file).filename().string());
+    field("format");
+    AppendString(out, report.format);
+    if (!report.source_file.empty()) {
+        field("source_file");
+        AppendString(out, report.source_file);
+    }
+
+    if (report.spec) {
+        field("seed");
+        out += std::to_string(report.spec->seed);
+
+        field("spec");
+        out += "{\n";
+        bool first = true;
+        for (const auto& [name, value] : CaseSpecLoader::Fields(*report.spec)) {
+            if (!first) out += ",\n";
+            first = false;
+            AppendKey(out, 4, name);
+            out += value;  // 数值和 true/false 均为合法的 JSON 字面量
+        }
+        out += "\n  }";
+    }
+
+    if (report.summary) {
+        const CaseSummary& s = *report.summary;
+        field("summary");
+        out += "{\n";
+        AppendKey(out, 4, "demand_count");
+        out += std::to_string(s.demand_count) + ",\n";
+        AppendKey(out, 4, "total_demand");
+        AppendReal(out, s.total_demand);
+        out += ",\n";
+        AppendKey(out, 4, "actual_utilization");
+        AppendReal(out, s.actual_utilization);
+        out += ",\n";
+        AppendKey(out, 4, "period_volume_cv");
+        AppendReal(out, s.period_volume_cv);
+        out += ",\n";
+        AppendKey(out, 4, "transfer_count");
+        out += std::to_string(s.transfer_count) + ",\n";
+        AppendKey(out, 4, "bigM_count");
+        out += std::to_string(s.bigM_count) + ",\n";
+        AppendKey(out, 4, "bigM_value");
+        AppendReal(out, s.bigM_value);
+        out += "\n  }";
+
+        const DemandGenStats& d = s.demand_stats;
+        const std::pair<const char*, uint64_t> stats[] = {
+            {"requested_points", d.requested_points},
+            {"generated_points", d.generated_points},
+            {"dropped_points", d.dropped_points},
+            {"allocation_passes", d.allocation_passes},
+            {"allocation_clamped", d.allocation_clamped},
+            {"item_rejections", d.item_rejections},
+            {"probe_fallbacks", d.probe_fallbacks},
+            {"probe_steps", d.probe_steps},
+            {"scaled_cells", d.scaled_cells},
+            {"scaled_points", d.scaled_points},
+        };
+        field("demand_stats");
+        out += "{\n";
+        for (size_t k = 0; k < std::size(stats); ++k) {
+            AppendKey(out, 4, stats[k].first);
+            out += std::to_string(stats[k].second);
+            out += k + 1 < std::size(stats) ? ",\n" : "\n";
+        }
+        out += "  }";
+    }
+
+    field("sections");
+    out += "{\n";
+    for (size_t k = 0; k < report.sections.size(); ++k) {
+        AppendKey(out, 4, report.sections[k].section);
+        out += std::to_string(report.sections[k].rows);
+        out += k + 1 < report.sections.size() ? ",\n" : "\n";
+    }
+    out += "  }";
+
+    field("rows_written");
+    out += std::to_string(report.rows_written);
+    field("bytes_written");
+    out += std::to_string(report.bytes_written);
+
+    field("phases_ms");
+    out += "{\n";
+    for (size_t k = 0; k < report.phase_nanos.size(); ++k) {
+        AppendKey(out, 4, report.phase_nanos[k].first);
+        AppendReal(out, static_cast<double>(report.phase_nanos[k].second) / 1e6);
+        out += k + 1 < report.phase_nanos.size() ? ",\n" : "\n";
+    }
+    out += "  }\n}\n";
+
+    std::string path = SidecarPath(report.case_file);
+    std::ofstream file(path, std::ios::binary);
+    if (!file || !file.write(out.data(), static_cast<std::streamsize>(out.size()))) {
+        throw std::runtime_error("无法写出运行报告: " + path);
+    }
+    return path;
+}
@@ -0,0 +1,74 @@
+/**
+ * ==================================================================================
+ * @file        run_report.h
+ * @brief       算例运行报告（JSON 附属文件）- 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 每写出一个算例文件，同时在旁边写出同名的 .json 报告，供数据集流水线建立索引，
+ * 无需再从中文日志中用正则提取，也无需重新读取算例：
+ *   case_20261016_120000_00012.csv  →  case_20261016_120000_00012.json
+ *
+ * 报告内容：
+ * - case_file / format / mode：算例文件、格式、运行模式（single / batch / convert）
+ * - spec：生效的完整规格（与规格文件字段同名，可直接用于复现），seed 单独列出
+ * - summary：需求数、总需求量、实际产能利用率、转运覆盖数、BigM
+ * - demand_stats：需求生成的退化路径统计
+ * - sections：各数据段的行数；rows_written / bytes_written：总行数和字节数
+ * - phases_ms：本算例各阶段耗时（毫秒）
+ *
+ * 转换模式没有规格，报告中改为 source_file，不含 spec / summary / demand_stats。
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include "case_generator.h"
+#include "case_spec.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct RunReport
+ * @brief  一个算例文件的运行报告
+ */
+struct RunReport {
+    std::string case_file;                 ///< 算例文件路径
+    std::string format;                    ///< 文件格式（csv / binary）
+    std::string mode;                      ///< 运行模式（single / batch / convert）
+    std::string source_file;               ///< 转换模式的输入文件（其他模式为空）
+
+    const CaseSpec* spec = nullptr;        ///< 生效的规格（转换模式为 nullptr）
+    const CaseSummary* summary = nullptr;  ///< 构建统计（转换模式为 nullptr）
+
+    std::vector<SectionRows> sections;     ///< 各数据段的行数
+    uint64_t rows_written = 0;             ///< 总行数
+    uint64_t bytes_written = 0;            ///< 总字节数
+
+    std::vector<std::pair<std::string, uint64_t>> phase_nanos;  ///< 各阶段耗时（纳秒）
+};
+
+/**
+ * @class RunReportWriter
+ * @brief 写出运行报告（静态类）
+ */
+class RunReportWriter {
+public:
+    /**
+     * @brief 算例文件对应的报告路径（扩展名替换为 .json）
+     */
+    static std::string SidecarPath(const std::string& case_file);
+
+    /**
+     * @brief 写出报告到 SidecarPath(report.case_file)
+     *
+     * @return std::string 报告文件路径
+     *
+     * @throw std::runtime_error 当文件无法写出时抛出异常
+     */
+    static std::string Write(const RunReport& report);
+};
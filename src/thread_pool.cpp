@@ -0,0 +1,199 @@
+/**
+ * ==================================================================================
+ * @file        thread_pool.cpp
+ * @brief       工作窃取线程池 - 实现文件
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * 本文件实现了 WorkStealingPool。
+ *
+ * 同步策略：
+ * - 每个队列由各自的互斥锁保护，窃取时只锁被窃取的队列
+ * - queued_ 计数在 wake_mutex_ 下被检查，提交任务后加锁通知，避免丢失唤醒
+ * - pending_ 归零时通知 wait()
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#include "thread_pool.h"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+// ====================================================================================
+// 构造函数和析构函数
+// ====================================================================================
+
+/**
+ * @brief 默认线程数
+ */
+unsigned WorkStealingPool::DefaultThreads() {
+    unsigned n = std::thread::hardware_concurrency();
+    return std::clamp(n, 1u, kMaxThreads);
+}
+
+/**
+ * @brief 解析命令行给出的线程数
+ */
+unsigned WorkStealingPool::ParseThreads(const std::string& text) {
+    unsigned value = 0;
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, value);
+    if (text.empty() || ec != std::errc() || ptr != end || value > kMaxThreads) {
+        throw std::runtime_error("线程数不合法: " + text + "（应为 0-" +
+                                 std::to_string(kMaxThreads) + " 的整数，0 表示全部硬件线程）");
+    }
+    return value;
+}
+
+/**
+ * @brief 构造函数实现 - 创建队列并启动工作线程
+ */
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+    if (threads == 0) threads = DefaultThreads();
+    threads = std::min(threads, kMaxThreads);
+
+    for (unsigned k = 0; k < threads; ++k) {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+    try {
+        for (unsigned k = 0; k < threads; ++k) {
+            workers_.emplace_back([this, k] { workerLoop(k); });
+        }
+    } catch (...) {
+        // 析构函数不会运行：先回收已启动的线程，否则销毁可 join 的 std::thread 会终止进程
+        stopWorkers();
+        throw;
+    }
+}
+
+/**
+ * @brief 析构函数实现 - 排空队列后停止线程
+ */
+WorkStealingPool::~WorkStealingPool() {
+    stopWorkers();
+}
+
+/**
+ * @brief 设置停止标志，唤醒并回收所有工作线程
+ */
+void WorkStealingPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stop_ = true;
+    }
+    wake_cv_.notify_all();
+    for (auto& w : workers_) {
+        w.join();
+    }
+}
+
+// ====================================================================================
+// 任务提交与等待
+// ====================================================================================
+
+/**
+ * @brief 提交任务到下一个队列（轮转分发）
+ */
+void WorkStealingPool::submit(std::function<void()> task) {
+    size_t q = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    // 计数先于入队增加，取任务时的递减不会出现下溢
+    pending_.fetch_add(1);
+    queued_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+        queues_[q]->tasks.push_back(std::move(task));
+    }
+
+    // 加锁后通知，保证等待中的线程不会错过这次唤醒
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+    }
+    wake_cv_.notify_one();
+}
+
+/**
+ * @brief 等待所有任务完成
+ */
+void WorkStealingPool::wait() {
+    {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        done_cv_.wait(lock, [this] { return pending_.load() == 0; });
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        error = first_error_;
+        first_error_ = nullptr;
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+// ====================================================================================
+// 工作线程
+// ====================================================================================
+
+/**
+ * @brief 取一个任务
+ *
+ * @details
+ * 自己的队列和其他队列都从头部取（最早提交的任务）。
+ * 提交方按开销从大到小提交时，每个线程先做自己队列中最大的任务，窃取到的也是剩余任务中较大的那些。
+ */
+bool WorkStealingPool::tryPop(unsigned id, std::function<void()>& task) {
+    {
+        TaskQueue& own = *queues_[id];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    for (size_t k = 1; k < queues_.size(); ++k) {
+        TaskQueue& victim = *queues_[(id + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief 工作线程主循环
+ */
+void WorkStealingPool::workerLoop(unsigned id) {
+    while (true) {
+        std::function<void()> task;
+        if (tryPop(id, task)) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!first_error_) first_error_ = std::current_exception();
+            }
+
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                done_cv_.notify_all();
+            }
+            continue;
+        }
+
+        // 没有可取的任务，等待新任务或停止信号
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        wake_cv_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+        if (stop_ && queued_.load() == 0) return;
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * ==================================================================================
+ * @file        thread_pool.h
+ * @brief       工作窃取线程池 - 接口定义
+ * @version     1.0.0
+ * @date        2026-10-16
+ *
+ * @description
+ * WorkStealingPool 为每个工作线程维护一个独立的任务队列：
+ * - 提交的任务按轮转方式分发到各队列
+ * - 线程按提交顺序从自己队列的头部取任务（FIFO，按开销从大到小提交时先做大任务）
+ * - 自己的队列为空时，从其他线程队列的头部窃取任务（同样先窃取大任务）
+ *
+ * 算例的生成开销相差可达百倍，静态划分会让部分线程早早空闲，
+ * 工作窃取保证所有线程在有任务时都保持忙碌。
+ *
+ * 使用示例：
+ * @code
+ * WorkStealingPool pool(0);               // 0 表示使用全部硬件线程
+ * for (size_t k = 0; k < n; ++k)
+ *     pool.submit([k] { Work(k); });
+ * pool.wait();                            // 等待全部完成，重新抛出任务异常
+ * @endcode
+ *
+ * @note 本类禁用拷贝构造和拷贝赋值
+ *
+ * @author      LS-Game-DataGen Team
+ * ==================================================================================
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class WorkStealingPool
+ * @brief 工作窃取线程池
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief 构造函数 - 启动工作线程
+     *
+     * @param threads 线程数（0 表示使用 DefaultThreads()，超过 kMaxThreads 时按 kMaxThreads）
+     *
+     * @throw std::system_error 当线程无法启动时抛出（已启动的线程会先停止并回收）
+     */
+    explicit WorkStealingPool(unsigned threads = 0);
+
+    /**
+     * @brief 析构函数 - 等待已提交的任务完成后停止所有线程
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief 提交一个任务
+     *
+     * @param task 任务函数
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief 等待所有已提交的任务完成
+     *
+     * @throw 任务抛出的第一个异常（其余任务仍会执行完毕）
+     */
+    void wait();
+
+    /**
+     * @brief 工作线程数
+     */
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+    /// 线程数上限
+    static constexpr unsigned kMaxThreads = 256;
+
+    /**
+     * @brief 默认线程数（硬件线程数，至少为1）
+     */
+    static unsigned DefaultThreads();
+
+    /**
+     * @brief 解析命令行给出的线程数
+     *
+     * @param text 十进制非负整数，0 表示全部硬件线程
+     * @return unsigned 线程数
+     *
+     * @throw std::runtime_error 当 text 不是 [0, kMaxThreads] 内的整数时抛出异常
+     */
+    static unsigned ParseThreads(const std::string& text);
+
+private:
+    /// 单个工作线程的任务队列
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;  ///< 每个工作线程一个队列
+    std::vector<std::thread> workers_;                ///< 工作线程
+
+    std::mutex wake_mutex_;              ///< 保护 stop_ 和条件变量等待
+    std::condition_variable wake_cv_;    ///< 有新任务或停止时唤醒工作线程
+    std::condition_variable done_cv_;    ///< 所有任务完成时唤醒 wait()
+    bool stop_ = false;                  ///< 停止标志
+
+    std::atomic<size_t> queued_{0};      ///< 队列中尚未被取走的任务数
+    std::atomic<size_t> pending_{0};     ///< 已提交但尚未完成的任务数
+    std::atomic<size_t> next_queue_{0};  ///< 轮转分发计数
+
+    std::mutex error_mutex_;             ///< 保护 first_error_
+    std::exception_ptr first_error_;     ///< 任务抛出的第一个异常
+
+    /**
+     * @brief 工作线程主循环
+     */
+    void workerLoop(unsigned id);
+
+    /**
+     * @brief 停止并回收所有已启动的工作线程
+     */
+    void stopWorkers();
+
+    /**
+     * @brief 取一个任务：先从自己队列头部取，再从其他队列头部窃取
+     */
+    bool tryPop(unsigned id, std::function<void()>& task);
+};